@@ -6,20 +6,28 @@
 #ifndef ARBOL_HPP
 #define ARBOL_HPP
 
-#include "Nodo.hpp"
+#include "NodoArbol.hpp"
+#include "../Instrumentacion/Instrumentacion.hpp"
 #include <iostream>
 #include <memory>
+#include <memory_resource>
 
 /**
  * @class Arbol
  * @brief Clase que representa un árbol binario.
  * 
  * Esta clase es una plantilla que permite crear árboles con cualquier tipo de dato.
+ * @tparam Instrumentacion Política de instrumentación; por defecto no mide nada.
+ * @tparam Asignador Asignador de los nodos: `std::allocator` o compatible, o `std::pmr::polymorphic_allocator`.
  */
-template <typename T>
+template <typename T, typename Instrumentacion = SinInstrumentacion, typename Asignador = std::allocator<T>>
 class Arbol {
     private:
-        std::unique_ptr<Nodo<T>> raiz;  ///Puntero a la raíz del árbol.
+        using NodoA = NodoArbol<T, Asignador>;
+        using Enlace = PunteroNodo<NodoA, Asignador>;
+
+        GestorNodos<NodoA, Asignador> gestor;  ///Crea los nodos con el asignador del árbol.
+        Enlace raiz;  ///Puntero a la raíz del árbol.
 
         /**
          * @brief Método recursivo para insertar un dato en el árbol.
@@ -30,10 +38,15 @@ class Arbol {
          * Si el dato es menor que el dato del nodo actual, se inserta en el subárbol izquierdo.
          * Si el dato es mayor o igual, se inserta en el subárbol derecho
          */
-        void insertarRecursivo(std::unique_ptr<Nodo<T>>& nodo, T& dato) {
+        void insertarRecursivo(Enlace& nodo, T& dato) {
             if (!nodo) {
-                nodo = std::make_unique<Nodo<T>>(dato);
-            } else if (dato < nodo->dato) {
+                Instrumentacion::asignacion();
+                nodo = gestor.crear(dato);
+                return;
+            }
+            Instrumentacion::comparacion();
+            Instrumentacion::salto();
+            if (dato < nodo->dato) {
                 insertarRecursivo(nodo->izquierdo, dato);
             } else {
                 insertarRecursivo(nodo->derecho, dato);
@@ -48,7 +61,7 @@ class Arbol {
          * Llama recursivamente al hijo izquierdo hasta que no haya más nodos, luego imprime el dato de ese último nodo izquierdo, imprime el nodo padre y finalmente recorre el hijo derecho en busca de más nodos hijos, esto continúa hasta que todas las llamadas
          * recursivas hayan terminado y se hayan impreso todos los nodos en orden ascendente.
          */
-        void inOrdenRecursivo(Nodo<T>* nodo) const {
+        void inOrdenRecursivo(NodoA* nodo) const {
             if (nodo) {
                 inOrdenRecursivo(nodo->izquierdo.get());
                 std::cout << nodo->dato << " ";
@@ -64,7 +77,7 @@ class Arbol {
          * Llama recursivamente al nodo actual, imprime su dato, luego recorre el hijo izquierdo en busca de más nodos hijos, y finalmente recorre el hijo derecho en busca de más nodos hijos.
          * Esto continúa hasta que todas las llamadas recursivas hayan terminado y se hayan impreso todos los nodos en preorden.
          */
-        void preOrdenRecursivo(Nodo<T>* nodo) const {
+        void preOrdenRecursivo(NodoA* nodo) const {
             if (nodo) {
                 std::cout << nodo->dato << " ";            // Primero imprime el nodo
                 preOrdenRecursivo(nodo->izquierdo.get());  // Luego visita izquierda
@@ -79,7 +92,7 @@ class Arbol {
          * Imprime los nodos del subárbol izquierdo, luego los nodos del subárbol derecho, y finalmente el nodo actual.
          * Llama recursivamente al hijo izquierdo en busca de más nodos hijos, luego recorre el hijo derecho en busca de más nodos hijos, y finalmente imprime el dato del nodo actual.
          */
-        void postOrdenRecursivo(Nodo<T>* nodo) const {
+        void postOrdenRecursivo(NodoA* nodo) const {
             if (nodo) {
                 postOrdenRecursivo(nodo->izquierdo.get());  // Visita izquierda
                 postOrdenRecursivo(nodo->derecho.get());    // Visita derecha
@@ -96,13 +109,17 @@ class Arbol {
          * Si el nodo es nulo, devuelve nullptr.
          * Si el dato es igual al dato del nodo actual, devuelve un puntero al nodo
          */
-        Nodo<T>* buscarNodo(Nodo<T>* nodo, const T& dato) const {
+        NodoA* buscarNodo(NodoA* nodo, const T& dato) const {
             if (!nodo) {
                 return nullptr;  // Si el nodo es nulo, no se encontró el dato
             }
+            Instrumentacion::comparacion();
             if (dato == nodo->dato) {
                 return nodo;  // Si el dato coincide, se devuelve el nodo
-            } else if (dato < nodo->dato) {
+            }
+            Instrumentacion::comparacion();
+            Instrumentacion::salto();
+            if (dato < nodo->dato) {
                 return buscarNodo(nodo->izquierdo.get(), dato);  // Buscar en el subárbol izquierdo
             } else {
                 return buscarNodo(nodo->derecho.get(), dato);    // Buscar en el subárbol derecho
@@ -118,7 +135,7 @@ class Arbol {
          * Si el nodo tiene un hijo izquierdo, se llama recursivamente al hijo izquierdo hasta que no haya más hijos izquierdos.
          * Finalmente, devuelve el nodo con el dato mínimo encontrado.
          */
-        Nodo<T>* encontrarMinimo(Nodo<T>* nodo) const {
+        NodoA* encontrarMinimo(NodoA* nodo) const {
             if (!nodo) {
                 return nullptr;  // Si el nodo es nulo, no hay mínimo
             }
@@ -137,7 +154,7 @@ class Arbol {
          * Si el nodo tiene un hijo derecho, se llama recursivamente al hijo derecho hasta que no haya más hijos derechos.
          * Finalmente, devuelve el nodo con el dato máximo encontrado.
          */
-        Nodo<T>* encontrarMaximo(Nodo<T>* nodo) const {
+        NodoA* encontrarMaximo(NodoA* nodo) const {
             if (!nodo) {
                 return nullptr;  // Si el nodo es nulo, no hay máximo
             }
@@ -150,12 +167,21 @@ class Arbol {
         /** 
          * @brief Método para limpiar el árbol.
          * Este método se utiliza internamente para liberar la memoria del árbol.
-         * Al asignar nullptr a la raíz, se libera la memoria de los nodos automáticamente.
-         * Esto es posible gracias a la gestión automática de memoria proporcionada por std::unique_ptr
-         * Esto evita fugas de memoria y asegura que todos los nodos sean eliminados correctamente.
+         * Asignar nullptr a la raíz liberaría los nodos de forma recursiva, y un árbol degenerado desbordaría la pila.
+         * Por eso, mientras la raíz tenga hijo izquierdo se rota a la derecha; cuando no lo tiene, se libera sola
+         * y su hijo derecho pasa a ser la raíz. Cada nodo se libera sin hijos, así que ninguna destrucción encadena otra.
          */
         void limpiarArbol(){
-            raiz = nullptr;  // Al asignar nullptr, se libera la memoria de los nodos automáticamente
+            while (raiz) {
+                if (raiz->izquierdo) {
+                    Enlace hijo = std::move(raiz->izquierdo);
+                    raiz->izquierdo = std::move(hijo->derecho);
+                    hijo->derecho = std::move(raiz);
+                    raiz = std::move(hijo);
+                } else {
+                    raiz = std::move(raiz->derecho);
+                }
+            }
         }
 
         /**
@@ -165,10 +191,12 @@ class Arbol {
          * Este método se utiliza internamente para eliminar un nodo del árbol.
          * Si el nodo es nulo, no se hace nada.
          */
-        std::unique_ptr<Nodo<T>>& eliminarNodo(std::unique_ptr<Nodo<T>>& nodo, T valor){
+        Enlace& eliminarNodo(Enlace& nodo, T valor){
             if (!nodo) {
                 return nodo;  // Si el nodo es nulo, no se hace nada
             }
+            Instrumentacion::comparacion();
+            Instrumentacion::salto();
             if (valor < nodo->dato) {
                 nodo->izquierdo = eliminarNodo(nodo->izquierdo, valor);  // Buscar en el subárbol izquierdo
             } else if (valor > nodo->dato) {
@@ -181,7 +209,7 @@ class Arbol {
                     return nodo = std::move(nodo->izquierdo);  // Si no tiene hijo derecho, devuelve el hijo izquierdo
                 } else {
                     // Nodo con dos hijos, encontrar el sucesor (mínimo del subárbol derecho)
-                    Nodo<T>* sucesor = encontrarMinimo(nodo->derecho.get());
+                    NodoA* sucesor = encontrarMinimo(nodo->derecho.get());
                     nodo->dato = sucesor->dato;  // Reemplazar el dato del nodo con el dato del sucesor
                     nodo->derecho = eliminarNodo(nodo->derecho, sucesor->dato);  // Eliminar el sucesor
                 }
@@ -200,7 +228,7 @@ class Arbol {
          * Finalmente, devuelve la altura máxima entre los hijos izquierdo y derecho más uno (para contar el nodo actual)
          * Esto permite calcular la altura del árbol de manera recursiva.
          */
-        int alturaRecursiva(Nodo<T>* nodo) const {
+        int alturaRecursiva(NodoA* nodo) const {
             if (!nodo) {
                 return -1;  // Altura de un árbol vacío
             }
@@ -220,7 +248,7 @@ class Arbol {
          * Finalmente, devuelve la suma de los nodos del hijo izquierdo, el nodo actual (1) y los nodos del hijo derecho.
          * Esto permite contar el número total de nodos en el árbol de manera recursiva
          */
-        int nodosRecursivo(Nodo<T>* nodo) const {
+        int nodosRecursivo(NodoA* nodo) const {
             if (!nodo) {
                 return 0;  // No hay nodos en un árbol vacío
             }
@@ -239,7 +267,7 @@ class Arbol {
          * Si el nodo tiene un hijo izquierdo, se llama recursivamente al hijo izquierdo.
          * Si el nodo tiene un hijo derecho, se llama recursivamente al hijo derecho.
          */
-        int hojasRecursivo(Nodo<T>* nodo) const {
+        int hojasRecursivo(NodoA* nodo) const {
             if (!nodo) {
                 return 0;  // No hay hojas en un árbol vacío
             }
@@ -256,7 +284,41 @@ class Arbol {
          * @brief Constructor del árbol.
          * Inicializa la raíz del árbol como nula.
          */
-        Arbol() : raiz(nullptr) {}
+        explicit Arbol(const Asignador& asignador = Asignador()) : gestor(asignador), raiz(nullptr) {}
+
+        /**
+         * @brief Destructor del árbol; libera los nodos de forma iterativa con limpiar().
+         */
+        ~Arbol() {
+            limpiarArbol();
+        }
+
+        Arbol(const Arbol&) = delete;
+        Arbol& operator=(const Arbol&) = delete;
+
+        /**
+         * @brief Constructor de movimiento: toma los nodos y el asignador de otro árbol, que queda vacío.
+         */
+        Arbol(Arbol&& otro) noexcept : gestor(otro.gestor), raiz(std::move(otro.raiz)) {}
+
+        /**
+         * @brief Asignación por movimiento: libera los nodos propios y toma los de otro árbol.
+         * El árbol conserva su asignador; los nodos tomados vuelven al del otro árbol cuando se liberan.
+         */
+        Arbol& operator=(Arbol&& otro) noexcept {
+            if (this != &otro) {
+                limpiarArbol();
+                raiz = std::move(otro.raiz);
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Devuelve una copia del asignador con el que se crean los nodos.
+         */
+        Asignador obtenerAsignador() const {
+            return gestor.obtenerAsignador();
+        }
 
         /**
          * @brief Método para insertar un dato en el árbol.
@@ -264,6 +326,7 @@ class Arbol {
          * Este método es público y se utiliza para insertar datos en el árbol.
          */
         void insertar(T dato) {
+            typename Instrumentacion::Temporizador medir("arbol_insertar");
             insertarRecursivo(raiz, dato);
         }
 
@@ -300,7 +363,8 @@ class Arbol {
          * @return Devolución de un puntero al nodo que contiene el dato, o nullptr si no se encuentra.
          * Este método es público y se utiliza para buscar un dato en el árbol.
          */
-        Nodo<T>* buscar(const T& dato) const {
+        NodoA* buscar(const T& dato) const {
+            typename Instrumentacion::Temporizador medir("arbol_buscar");
             return buscarNodo(raiz.get(), dato);
         }
 
@@ -309,7 +373,7 @@ class Arbol {
          * @return Devolución de un puntero al nodo con el dato mínimo, o nullptr si el árbol está vacío.
          * Este método es público y se utiliza para encontrar el nodo con el dato mínimo en el árbol.
          */
-        Nodo<T>* minimo() const {
+        NodoA* minimo() const {
             return encontrarMinimo(raiz.get());
         }
 
@@ -318,13 +382,13 @@ class Arbol {
          * @return Devolución de un puntero al nodo con el dato máximo, o nullptr si el árbol está vacío.
          * Este método es público y se utiliza para encontrar el nodo con el dato máximo en el árbol.
          */
-        Nodo<T>* maximo() const {
+        NodoA* maximo() const {
             return encontrarMaximo(raiz.get());
         }
 
         /**
-         * @brief Destructor del árbol.
-         * Limpia el árbol al asignar nullptr a la raíz, liberando la memoria de los nodos automáticamente.
+         * @brief Método para limpiar el árbol.
+         * Libera todos los nodos de forma iterativa.
          */
         void limpiar() {
             limpiarArbol();
@@ -336,6 +400,7 @@ class Arbol {
          * Este método es público y se utiliza para eliminar un nodo del árbol.
          */
         void eliminar(T dato) {
+            typename Instrumentacion::Temporizador medir("arbol_eliminar");
             eliminarNodo(raiz, dato);
         }
 
@@ -367,4 +432,8 @@ class Arbol {
         }
 };
 
+/// Árbol cuyos nodos se piden a un `std::pmr::memory_resource`, por ejemplo RecursoMonotono o RecursoPoolNodos.
+template <typename T, typename Instrumentacion = SinInstrumentacion>
+using ArbolPmr = Arbol<T, Instrumentacion, std::pmr::polymorphic_allocator<T>>;
+
 #endif
\ No newline at end of file
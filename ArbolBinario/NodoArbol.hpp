@@ -0,0 +1,35 @@
+/**
+ * @file NodoArbol.hpp
+ * @brief Declaracion de la clase NodoArbol para la estructura de datos de un árbol binario.
+ */
+#ifndef NODOARBOL_HPP
+#define NODOARBOL_HPP
+
+#include "../Memoria/GestorNodos.hpp"
+#include <iostream>
+#include <memory>
+
+template <typename T, typename Asignador = std::allocator<T>>
+
+/**
+ * @class NodoArbol
+ * @brief Clase que representa un nodo en un árbol binario.
+ * 
+ * Esta clase es una plantilla que permite crear nodos con cualquier tipo de dato.
+ * Los punteros a los hijos usan el asignador del árbol para liberar los nodos.
+ */
+class NodoArbol {
+    public:
+        T dato;  ///< Dato almacenado en el nodo.
+        PunteroNodo<NodoArbol<T, Asignador>, Asignador> izquierdo;  // Puntero al hijo izquierdo.
+        PunteroNodo<NodoArbol<T, Asignador>, Asignador> derecho;    // Puntero al hijo derecho.
+
+        /**
+         * @brief Constructor del nodo.
+         * @param d Dato a almacenar en el nodo.
+         */
+        NodoArbol(T d) : dato(d), izquierdo(nullptr), derecho(nullptr) {}
+    
+};
+
+#endif
\ No newline at end of file
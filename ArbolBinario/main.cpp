@@ -19,21 +19,21 @@ int main() {
     arbol.postOrden(); // Debería mostrar: 3 7 5 15 10
 
     int datoBuscado = 7;
-    Nodo<int>* nodoEncontrado = arbol.buscar(datoBuscado);
+    NodoArbol<int>* nodoEncontrado = arbol.buscar(datoBuscado);
     if (nodoEncontrado) {
         std::cout << "Dato encontrado: " << nodoEncontrado->dato << std::endl;
     } else {
         std::cout << "Dato no encontrado." << std::endl;
     }
 
-    Nodo<int>* minimo = arbol.minimo();
+    NodoArbol<int>* minimo = arbol.minimo();
     if (minimo) {
         std::cout << "Mínimo: " << minimo->dato << std::endl; // Debería mostrar: 3
     } else {
         std::cout << "El árbol está vacío." << std::endl;
     }
 
-    Nodo<int>* maximo = arbol.maximo();
+    NodoArbol<int>* maximo = arbol.maximo();
     if (maximo) {
         std::cout << "Máximo: " << maximo->dato << std::endl; // Debería mostrar: 15
     } else {
@@ -0,0 +1,470 @@
+/**
+ * @file ArregloDinamico.hpp
+ * @brief Definición de la clase ArregloDinamico, un arreglo contiguo que crece según se necesite.
+ * Reemplaza a los arreglos de tamaño fijo creados con new[] o std::make_unique<T[]>: crece de forma geométrica,
+ * guarda los primeros elementos dentro del propio objeto (sin pedir memoria) y, para tipos triviales,
+ * mueve los elementos con memcpy al crecer.
+ */
+#ifndef ARREGLODINAMICO_HPP
+#define ARREGLODINAMICO_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+/**
+ * @struct ReservaEstandar
+ * @brief Política de reserva por defecto: operator new con la alineación del tipo.
+ */
+struct ReservaEstandar {
+    static void* reservar(std::size_t bytes, std::size_t alineacion) {
+        return ::operator new(bytes, std::align_val_t(alineacion));
+    }
+
+    static void liberar(void* memoria, std::size_t, std::size_t alineacion) {
+        ::operator delete(memoria, std::align_val_t(alineacion));
+    }
+};
+
+/**
+ * @struct ReservaPaginasGrandes
+ * @brief Política de reserva para arreglos grandes: los bloques de 2 MiB o más se alinean a 2 MiB
+ * y, en Linux, se le pide al sistema que los respalde con páginas grandes (menos fallos de TLB al recorrerlos).
+ * Los bloques pequeños se reservan igual que con ReservaEstandar.
+ */
+struct ReservaPaginasGrandes {
+    static constexpr std::size_t TAMANO_PAGINA = std::size_t(2) << 20;
+
+    static std::size_t redondear(std::size_t bytes) {
+        return (bytes + TAMANO_PAGINA - 1) / TAMANO_PAGINA * TAMANO_PAGINA;
+    }
+
+    static void* reservar(std::size_t bytes, std::size_t alineacion) {
+        if (bytes < TAMANO_PAGINA) {
+            return ReservaEstandar::reservar(bytes, alineacion);
+        }
+        // Redondear un tamaño tan grande daría la vuelta a 0
+        if (bytes > std::numeric_limits<std::size_t>::max() - TAMANO_PAGINA) {
+            throw std::bad_alloc();
+        }
+        // operator new alineado existe en todas las plataformas, a diferencia de std::aligned_alloc
+        void* memoria = ::operator new(redondear(bytes), std::align_val_t(TAMANO_PAGINA));
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+        // Es sólo una sugerencia: si el sistema no tiene páginas grandes disponibles, se usan las normales
+        madvise(memoria, redondear(bytes), MADV_HUGEPAGE);
+#endif
+        return memoria;
+    }
+
+    static void liberar(void* memoria, std::size_t bytes, std::size_t alineacion) {
+        if (bytes < TAMANO_PAGINA) {
+            ReservaEstandar::liberar(memoria, bytes, alineacion);
+        } else {
+            ::operator delete(memoria, std::align_val_t(TAMANO_PAGINA));
+        }
+    }
+};
+
+/**
+ * @brief Espacio para los elementos guardados dentro del objeto; con capacidad 0 no ocupa nada.
+ */
+template <typename T, std::size_t N>
+struct AlmacenEnLinea {
+    alignas(T) unsigned char bytes[N * sizeof(T)];
+    T* datos() { return reinterpret_cast<T*>(bytes); }
+    const T* datos() const { return reinterpret_cast<const T*>(bytes); }
+};
+
+template <typename T>
+struct AlmacenEnLinea<T, 0> {
+    T* datos() { return nullptr; }
+    const T* datos() const { return nullptr; }
+};
+
+/**
+ * @class ArregloDinamico
+ * @brief Arreglo contiguo de tamaño variable.
+ *
+ * Los primeros EnLinea elementos viven dentro del objeto; sólo al superarlos se pide memoria al montón.
+ * Al llenarse, la capacidad crece 1.5 veces, así que agregar al final cuesta O(1) amortizado.
+ * Si T se puede copiar byte a byte (std::is_trivially_copyable), al crecer se mueve todo con un solo memcpy;
+ * si no, se mueve elemento por elemento (o se copia, si mover puede lanzar una excepción).
+ * @tparam T Tipo de dato almacenado.
+ * @tparam EnLinea Cantidad de elementos que caben sin reservar memoria.
+ * @tparam Reserva Política de reserva de memoria (ReservaEstandar o ReservaPaginasGrandes).
+ */
+template <typename T, std::size_t EnLinea = 0, typename Reserva = ReservaEstandar>
+class ArregloDinamico {
+    private:
+        T* inicio;              ///< Primer elemento; apunta al almacén en línea o a memoria del montón.
+        std::size_t tamanio;    ///< Elementos construidos.
+        std::size_t capacidad;  ///< Elementos que caben antes de crecer.
+        AlmacenEnLinea<T, EnLinea> enLinea;
+
+        static constexpr bool TRIVIAL = std::is_trivially_copyable<T>::value;
+
+        bool usaEnLinea() const {
+            return EnLinea > 0 && inicio == enLinea.datos();
+        }
+
+        /**
+         * @brief Construye en destino los n elementos de origen moviéndolos, y destruye los de origen.
+         * Los de origen se destruyen sólo cuando ya están todos construidos en destino: si una copia lanza una
+         * excepción, se destruyen los ya construidos en destino y origen queda intacto.
+         */
+        static void reubicar(T* origen, std::size_t n, T* destino) {
+            if (TRIVIAL) {
+                if (n > 0) {
+                    std::memcpy(static_cast<void*>(destino), static_cast<const void*>(origen), n * sizeof(T));
+                }
+                return;
+            }
+            std::size_t construidos = 0;
+            try {
+                for (; construidos < n; ++construidos) {
+                    new (destino + construidos) T(std::move_if_noexcept(origen[construidos]));
+                }
+            } catch (...) {
+                for (std::size_t i = 0; i < construidos; ++i) {
+                    destino[i].~T();
+                }
+                throw;
+            }
+            for (std::size_t i = 0; i < n; ++i) {
+                origen[i].~T();
+            }
+        }
+
+        void destruirElementos() {
+            if (!std::is_trivially_destructible<T>::value) {
+                for (std::size_t i = 0; i < tamanio; ++i) {
+                    inicio[i].~T();
+                }
+            }
+            tamanio = 0;
+        }
+
+        void liberarMemoria() {
+            if (inicio != nullptr && !usaEnLinea()) {
+                Reserva::liberar(inicio, capacidad * sizeof(T), alignof(T));
+            }
+            inicio = enLinea.datos();
+            capacidad = EnLinea;
+        }
+
+        /**
+         * @brief Cambia la memoria a un bloque de nuevaCapacidad elementos (mayor o igual que el tamaño).
+         */
+        void reubicarEn(std::size_t nuevaCapacidad) {
+            T* nuevo;
+            if (nuevaCapacidad <= EnLinea) {
+                nuevo = enLinea.datos();
+                nuevaCapacidad = EnLinea;
+            } else {
+                nuevo = static_cast<T*>(Reserva::reservar(nuevaCapacidad * sizeof(T), alignof(T)));
+            }
+            if (nuevo == inicio) {
+                return;
+            }
+            try {
+                reubicar(inicio, tamanio, nuevo);
+            } catch (...) {
+                if (nuevo != enLinea.datos()) {
+                    Reserva::liberar(nuevo, nuevaCapacidad * sizeof(T), alignof(T));
+                }
+                throw;
+            }
+            std::size_t n = tamanio;
+            tamanio = 0;
+            liberarMemoria();
+            inicio = nuevo;
+            capacidad = nuevaCapacidad;
+            tamanio = n;
+        }
+
+        /**
+         * @brief Capacidad a la que se crece cuando se necesitan al menos minimo elementos.
+         */
+        std::size_t capacidadPara(std::size_t minimo) const {
+            std::size_t crecida = capacidad + capacidad / 2;
+            if (crecida < 4) {
+                crecida = 4;
+            }
+            return crecida > minimo ? crecida : minimo;
+        }
+
+    public:
+        /**
+         * @brief Constructor de la clase ArregloDinamico.
+         * Inicializa un arreglo vacío que no ha pedido memoria.
+         */
+        ArregloDinamico() : tamanio(0), capacidad(EnLinea) {
+            inicio = enLinea.datos();
+        }
+
+        /**
+         * @brief Crea un arreglo de n elementos construidos por defecto (para enteros, en cero).
+         */
+        explicit ArregloDinamico(std::size_t n) : ArregloDinamico() {
+            redimensionar(n);
+        }
+
+        ArregloDinamico(std::initializer_list<T> valores) : ArregloDinamico() {
+            reservar(valores.size());
+            for (const T& valor : valores) {
+                new (inicio + tamanio) T(valor);
+                ++tamanio;
+            }
+        }
+
+        ArregloDinamico(const ArregloDinamico& otro) : ArregloDinamico() {
+            reservar(otro.tamanio);
+            if (TRIVIAL) {
+                if (otro.tamanio > 0) {
+                    std::memcpy(static_cast<void*>(inicio), static_cast<const void*>(otro.inicio), otro.tamanio * sizeof(T));
+                }
+                tamanio = otro.tamanio;
+                return;
+            }
+            for (std::size_t i = 0; i < otro.tamanio; ++i) {
+                new (inicio + i) T(otro.inicio[i]);
+                ++tamanio;
+            }
+        }
+
+        /**
+         * @brief Toma la memoria de otro; si otro usaba su almacén en línea, se mueven sus elementos uno a uno.
+         */
+        ArregloDinamico(ArregloDinamico&& otro) noexcept(std::is_nothrow_move_constructible<T>::value) : ArregloDinamico() {
+            tomarDe(otro);
+        }
+
+        ArregloDinamico& operator=(const ArregloDinamico& otro) {
+            if (this != &otro) {
+                ArregloDinamico copia(otro);
+                limpiar();
+                liberarMemoria();
+                tomarDe(copia);
+            }
+            return *this;
+        }
+
+        ArregloDinamico& operator=(ArregloDinamico&& otro) noexcept(std::is_nothrow_move_constructible<T>::value) {
+            if (this != &otro) {
+                limpiar();
+                liberarMemoria();
+                tomarDe(otro);
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Destructor de la clase ArregloDinamico.
+         * Destruye los elementos y devuelve la memoria.
+         */
+        ~ArregloDinamico() {
+            destruirElementos();
+            liberarMemoria();
+        }
+
+        /**
+         * @brief Se asegura de que quepan al menos n elementos sin volver a crecer.
+         * @param n Capacidad mínima deseada.
+         */
+        void reservar(std::size_t n) {
+            if (n > capacidad) {
+                reubicarEn(n);
+            }
+        }
+
+        /**
+         * @brief Agrega una copia de valor al final.
+         * @param valor El valor a agregar.
+         */
+        void agregar(const T& valor) {
+            construirAlFinal(valor);
+        }
+
+        /**
+         * @brief Agrega valor al final moviéndolo.
+         * @param valor El valor a agregar.
+         */
+        void agregar(T&& valor) {
+            construirAlFinal(std::move(valor));
+        }
+
+        /**
+         * @brief Construye un elemento al final directamente con los argumentos dados (como emplace_back).
+         * @return Referencia al elemento construido.
+         */
+        template <typename... Args>
+        T& construirAlFinal(Args&&... args) {
+            if (tamanio == capacidad) {
+                // Se construye primero en la memoria nueva por si los argumentos apuntan dentro de este arreglo
+                std::size_t nuevaCapacidad = capacidadPara(tamanio + 1);
+                T* nuevo = static_cast<T*>(Reserva::reservar(nuevaCapacidad * sizeof(T), alignof(T)));
+                try {
+                    new (nuevo + tamanio) T(std::forward<Args>(args)...);
+                } catch (...) {
+                    Reserva::liberar(nuevo, nuevaCapacidad * sizeof(T), alignof(T));
+                    throw;
+                }
+                try {
+                    reubicar(inicio, tamanio, nuevo);
+                } catch (...) {
+                    nuevo[tamanio].~T();
+                    Reserva::liberar(nuevo, nuevaCapacidad * sizeof(T), alignof(T));
+                    throw;
+                }
+                std::size_t n = tamanio;
+                tamanio = 0;
+                liberarMemoria();
+                inicio = nuevo;
+                capacidad = nuevaCapacidad;
+                tamanio = n + 1;
+                return inicio[n];
+            }
+            new (inicio + tamanio) T(std::forward<Args>(args)...);
+            return inicio[tamanio++];
+        }
+
+        /**
+         * @brief Elimina el último elemento.
+         * @throws std::out_of_range Si el arreglo está vacío.
+         */
+        void quitarUltimo() {
+            if (tamanio == 0) {
+                throw std::out_of_range("El arreglo está vacío, no se puede quitar un elemento.");
+            }
+            --tamanio;
+            inicio[tamanio].~T();
+        }
+
+        /**
+         * @brief Cambia el tamaño a n: los elementos nuevos se construyen por defecto y los sobrantes se destruyen.
+         */
+        void redimensionar(std::size_t n) {
+            if (n < tamanio) {
+                while (tamanio > n) {
+                    inicio[--tamanio].~T();
+                }
+                return;
+            }
+            reservar(n);
+            while (tamanio < n) {
+                new (inicio + tamanio) T();
+                ++tamanio;
+            }
+        }
+
+        /**
+         * @brief Reduce la capacidad al tamaño actual (o al almacén en línea, si cabe en él).
+         */
+        void ajustarCapacidad() {
+            if (capacidad > tamanio && !usaEnLinea()) {
+                if (tamanio == 0 && EnLinea == 0) {
+                    liberarMemoria();
+                    return;
+                }
+                reubicarEn(tamanio);
+            }
+        }
+
+        /**
+         * @brief Destruye todos los elementos; la capacidad se conserva.
+         */
+        void limpiar() {
+            destruirElementos();
+        }
+
+        T& operator[](std::size_t i) { return inicio[i]; }
+        const T& operator[](std::size_t i) const { return inicio[i]; }
+
+        /**
+         * @brief Acceso con verificación de límites.
+         * @throws std::out_of_range Si i no es una posición válida.
+         */
+        T& en(std::size_t i) {
+            if (i >= tamanio) {
+                throw std::out_of_range("Posición " + std::to_string(i) + " fuera del arreglo de " + std::to_string(tamanio) + " elementos.");
+            }
+            return inicio[i];
+        }
+
+        const T& en(std::size_t i) const {
+            return const_cast<ArregloDinamico*>(this)->en(i);
+        }
+
+        /**
+         * @brief Obtiene el primer elemento.
+         * @throws std::runtime_error Si el arreglo está vacío.
+         */
+        T& primero() {
+            if (tamanio == 0) {
+                throw std::runtime_error("El arreglo está vacío");
+            }
+            return inicio[0];
+        }
+
+        /**
+         * @brief Obtiene el último elemento.
+         * @throws std::runtime_error Si el arreglo está vacío.
+         */
+        T& ultimo() {
+            if (tamanio == 0) {
+                throw std::runtime_error("El arreglo está vacío");
+            }
+            return inicio[tamanio - 1];
+        }
+
+        T* datos() { return inicio; }
+        const T* datos() const { return inicio; }
+        T* begin() { return inicio; }
+        T* end() { return inicio + tamanio; }
+        const T* begin() const { return inicio; }
+        const T* end() const { return inicio + tamanio; }
+
+        std::size_t obtenerTamano() const { return tamanio; }
+        std::size_t obtenerCapacidad() const { return capacidad; }
+        bool estaVacio() const { return tamanio == 0; }
+
+        /**
+         * @brief Indica si los elementos están en el almacén en línea, sin memoria del montón.
+         */
+        bool enAlmacenEnLinea() const { return EnLinea > 0 && usaEnLinea(); }
+
+    private:
+        /**
+         * @brief Pasa el contenido de otro a este arreglo, que debe estar vacío y sin memoria propia.
+         */
+        void tomarDe(ArregloDinamico& otro) {
+            if (otro.inicio == nullptr) {
+                return;
+            }
+            if (otro.usaEnLinea()) {
+                reubicar(otro.inicio, otro.tamanio, inicio);
+                tamanio = otro.tamanio;
+                otro.tamanio = 0;
+                return;
+            }
+            inicio = otro.inicio;
+            tamanio = otro.tamanio;
+            capacidad = otro.capacidad;
+            otro.inicio = otro.enLinea.datos();
+            otro.tamanio = 0;
+            otro.capacidad = EnLinea;
+        }
+};
+
+#endif
@@ -0,0 +1,84 @@
+/**
+ * @file main.cpp
+ * @brief Programa de ejemplo de la clase ArregloDinamico.
+ * Muestra el almacén en línea, el crecimiento geométrico y compara el tiempo de agregar
+ * millones de enteros contra std::vector y contra un arreglo que crece de uno en uno con new[].
+ */
+#include "ArregloDinamico.hpp"
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+double milisegundosDesde(std::chrono::steady_clock::time_point inicio) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - inicio).count();
+}
+}
+
+int main() {
+    // Hasta 4 nombres caben dentro del objeto, sin pedir memoria
+    ArregloDinamico<std::string, 4> nombres;
+    nombres.agregar("Ana");
+    nombres.construirAlFinal(3, 'x');
+    std::cout << "Nombres: " << nombres.obtenerTamano() << ", en línea: " << (nombres.enAlmacenEnLinea() ? "sí" : "no") << "\n";
+    for (int i = 0; i < 5; ++i) {
+        nombres.agregar("Persona " + std::to_string(i));
+    }
+    std::cout << "Nombres: " << nombres.obtenerTamano() << ", en línea: " << (nombres.enAlmacenEnLinea() ? "sí" : "no")
+              << ", capacidad: " << nombres.obtenerCapacidad() << "\n";
+
+    ArregloDinamico<int> pequeno{1, 2, 3};
+    try {
+        pequeno.en(10);
+    } catch (const std::out_of_range& e) {
+        std::cout << "Error esperado: " << e.what() << "\n";
+    }
+
+    const int N = 10000000;
+
+    auto inicio = std::chrono::steady_clock::now();
+    ArregloDinamico<int> propio;
+    for (int i = 0; i < N; ++i) {
+        propio.agregar(i);
+    }
+    double msPropio = milisegundosDesde(inicio);
+
+    inicio = std::chrono::steady_clock::now();
+    ArregloDinamico<int, 0, ReservaPaginasGrandes> grande;
+    for (int i = 0; i < N; ++i) {
+        grande.agregar(i);
+    }
+    double msGrande = milisegundosDesde(inicio);
+
+    inicio = std::chrono::steady_clock::now();
+    std::vector<int> vector;
+    for (int i = 0; i < N; ++i) {
+        vector.push_back(i);
+    }
+    double msVector = milisegundosDesde(inicio);
+
+    // Crecer de uno en uno con new[] copia todo el arreglo en cada inserción: sólo se prueba con pocos elementos
+    const int M = 20000;
+    inicio = std::chrono::steady_clock::now();
+    int* crudo = nullptr;
+    for (int i = 0; i < M; ++i) {
+        int* nuevo = new int[i + 1];
+        for (int j = 0; j < i; ++j) {
+            nuevo[j] = crudo[j];
+        }
+        nuevo[i] = i;
+        delete[] crudo;
+        crudo = nuevo;
+    }
+    double msCrudo = milisegundosDesde(inicio);
+    delete[] crudo;
+
+    std::cout << "ArregloDinamico:            " << N << " elementos en " << msPropio << " ms\n";
+    std::cout << "Con páginas grandes:        " << N << " elementos en " << msGrande << " ms\n";
+    std::cout << "std::vector:                " << N << " elementos en " << msVector << " ms\n";
+    std::cout << "new[] creciendo de uno en uno: " << M << " elementos en " << msCrudo << " ms\n";
+    std::cout << "Último: " << propio.ultimo() << " " << grande.ultimo() << " " << vector.back() << "\n";
+
+    return 0;
+}
@@ -0,0 +1,428 @@
+/**
+ * @file Benchmark.hpp
+ * @brief Arnés mínimo de benchmarks, al estilo de Google Benchmark pero sin dependencias.
+ * Cada caso se corre para varios tamaños (de 1e3 a 1e8) y distribuciones de claves (ordenada, aleatoria, zipf)
+ * y se reporta ns/op, asignaciones/op y, si el sistema lo permite, fallos de caché e instrucciones por operación
+ * leídos de los contadores de hardware (perf_event_open en Linux).
+ * La salida JSON usa los mismos campos que Google Benchmark (name, iterations, real_time, cpu_time, time_unit),
+ * así que sirve con sus herramientas de comparación.
+ */
+#ifndef BENCHMARK_HPP
+#define BENCHMARK_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <regex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Asignaciones de memoria hechas por el programa.
+ * Sólo avanza si el ejecutable reemplaza operator new para contarlas (ver Benchmark/main.cpp).
+ */
+inline std::atomic<std::uint64_t> asignacionesContadas{0};
+
+/**
+ * @brief Orden en que se generan las claves de cada caso.
+ */
+enum class Distribucion {
+    Ordenada,  ///< 0, 1, 2, ..., n-1.
+    Aleatoria, ///< Una permutación aleatoria de 0..n-1.
+    Zipf       ///< Claves repetidas con frecuencia proporcional a 1/rango: pocas claves muy frecuentes.
+};
+
+inline const char* nombreDistribucion(Distribucion d) {
+    switch (d) {
+        case Distribucion::Ordenada: return "ordenada";
+        case Distribucion::Aleatoria: return "aleatoria";
+        case Distribucion::Zipf: return "zipf";
+    }
+    return "?";
+}
+
+/**
+ * @brief Genera n claves con la distribución pedida, siempre iguales para la misma semilla.
+ * La distribución de Zipf (exponente 1) se aproxima invirtiendo su versión continua:
+ * el rango es floor((n + 1)^u) con u uniforme en [0, 1), y la clave es rango - 1.
+ */
+inline std::vector<int> generarClaves(std::size_t n, Distribucion distribucion, std::uint64_t semilla) {
+    std::vector<int> claves(n);
+    std::mt19937_64 generador(semilla);
+    switch (distribucion) {
+        case Distribucion::Ordenada:
+            std::iota(claves.begin(), claves.end(), 0);
+            break;
+        case Distribucion::Aleatoria:
+            std::iota(claves.begin(), claves.end(), 0);
+            std::shuffle(claves.begin(), claves.end(), generador);
+            break;
+        case Distribucion::Zipf: {
+            std::uniform_real_distribution<double> uniforme(0.0, 1.0);
+            const double logaritmo = std::log(static_cast<double>(n) + 1.0);
+            for (int& clave : claves) {
+                double rango = std::floor(std::exp(uniforme(generador) * logaritmo));
+                clave = static_cast<int>(std::min<double>(rango, static_cast<double>(n))) - 1;
+            }
+            break;
+        }
+    }
+    return claves;
+}
+
+/**
+ * @class ContadoresHardware
+ * @brief Fallos de caché e instrucciones ejecutadas por este hilo, leídos con perf_event_open.
+ * En sistemas sin soporte (o sin permiso, según /proc/sys/kernel/perf_event_paranoid) disponible() es false
+ * y las lecturas valen cero.
+ */
+class ContadoresHardware {
+    private:
+        int fallosCache = -1;
+        int instrucciones = -1;
+
+#ifdef __linux__
+        static int abrir(std::uint64_t configuracion) {
+            perf_event_attr atributos{};
+            atributos.type = PERF_TYPE_HARDWARE;
+            atributos.size = sizeof(atributos);
+            atributos.config = configuracion;
+            atributos.disabled = 1;
+            atributos.exclude_kernel = 1;
+            atributos.exclude_hv = 1;
+            return static_cast<int>(syscall(SYS_perf_event_open, &atributos, 0, -1, -1, 0));
+        }
+
+        static std::uint64_t leer(int descriptor) {
+            std::uint64_t valor = 0;
+            if (descriptor >= 0 && read(descriptor, &valor, sizeof(valor)) != static_cast<ssize_t>(sizeof(valor))) {
+                valor = 0;
+            }
+            return valor;
+        }
+#endif
+
+    public:
+        struct Lectura {
+            std::uint64_t fallosCache = 0;
+            std::uint64_t instrucciones = 0;
+        };
+
+        ContadoresHardware() {
+#ifdef __linux__
+            fallosCache = abrir(PERF_COUNT_HW_CACHE_MISSES);
+            instrucciones = abrir(PERF_COUNT_HW_INSTRUCTIONS);
+            if (fallosCache < 0 || instrucciones < 0) {
+                cerrar();
+            }
+#endif
+        }
+
+        ~ContadoresHardware() {
+            cerrar();
+        }
+
+        ContadoresHardware(const ContadoresHardware&) = delete;
+        ContadoresHardware& operator=(const ContadoresHardware&) = delete;
+
+        void cerrar() {
+#ifdef __linux__
+            if (fallosCache >= 0) close(fallosCache);
+            if (instrucciones >= 0) close(instrucciones);
+#endif
+            fallosCache = -1;
+            instrucciones = -1;
+        }
+
+        bool disponible() const { return fallosCache >= 0; }
+
+        void iniciar() {
+#ifdef __linux__
+            if (disponible()) {
+                ioctl(fallosCache, PERF_EVENT_IOC_RESET, 0);
+                ioctl(instrucciones, PERF_EVENT_IOC_RESET, 0);
+                ioctl(fallosCache, PERF_EVENT_IOC_ENABLE, 0);
+                ioctl(instrucciones, PERF_EVENT_IOC_ENABLE, 0);
+            }
+#endif
+        }
+
+        Lectura detener() {
+            Lectura lectura;
+#ifdef __linux__
+            if (disponible()) {
+                ioctl(fallosCache, PERF_EVENT_IOC_DISABLE, 0);
+                ioctl(instrucciones, PERF_EVENT_IOC_DISABLE, 0);
+                lectura.fallosCache = leer(fallosCache);
+                lectura.instrucciones = leer(instrucciones);
+            }
+#endif
+            return lectura;
+        }
+};
+
+/**
+ * @brief Trabajo a medir: hace una repetición completa y devuelve cuántas operaciones hizo.
+ */
+using Medible = std::function<std::uint64_t()>;
+
+/**
+ * @brief Prepara un caso para unas claves dadas (fuera de la medición) y devuelve el trabajo a medir.
+ */
+using Preparador = std::function<Medible(const std::vector<int>& claves)>;
+
+/**
+ * @struct Caso
+ * @brief Un benchmark registrado.
+ */
+struct Caso {
+    std::string nombre;              ///< Por ejemplo "Pila/push".
+    Preparador preparar;
+    std::size_t tamanoMaximo;        ///< Tamaño más grande que tiene sentido medir (por ejemplo, en operaciones O(n^2)).
+    std::size_t tamanoMaximoSesgado; ///< Límite con claves ordenadas o zipf, para estructuras que degeneran con ellas.
+};
+
+/**
+ * @struct Resultado
+ * @brief Medición de un caso para un tamaño y una distribución.
+ */
+struct Resultado {
+    std::string nombre;
+    std::size_t tamano = 0;
+    Distribucion distribucion = Distribucion::Ordenada;
+    std::uint64_t repeticiones = 0;
+    std::uint64_t operaciones = 0;
+    double nsPorOperacion = 0;
+    double nsCpuPorOperacion = 0;
+    double asignacionesPorOperacion = 0;
+    bool conContadores = false;
+    double fallosCachePorOperacion = 0;
+    double instruccionesPorOperacion = 0;
+};
+
+/**
+ * @struct Opciones
+ * @brief Configuración de una corrida, normalmente leída de la línea de comandos.
+ */
+struct Opciones {
+    std::vector<std::size_t> tamanos{1000, 10000, 100000, 1000000};
+    std::vector<Distribucion> distribuciones{Distribucion::Ordenada, Distribucion::Aleatoria, Distribucion::Zipf};
+    std::string filtro = ".*";
+    std::string rutaJson;
+    double tiempoMinimo = 0.2; ///< Segundos que se repite cada medición como mínimo.
+    std::uint64_t semilla = 42;
+};
+
+/**
+ * @brief Lee las opciones de la línea de comandos.
+ * --tamanos=1e3,1e4  --distribuciones=ordenada,aleatoria,zipf  --filtro=<regex>
+ * --json=<ruta>  --tiempo-minimo=<segundos>  --semilla=<n>
+ * @throws std::invalid_argument Si una opción no se reconoce o su valor no es válido.
+ */
+inline Opciones leerOpciones(int argc, char* argv[]) {
+    Opciones opciones;
+    auto separar = [](const std::string& texto) {
+        std::vector<std::string> partes;
+        std::stringstream flujo(texto);
+        std::string parte;
+        while (std::getline(flujo, parte, ',')) {
+            if (!parte.empty()) {
+                partes.push_back(parte);
+            }
+        }
+        return partes;
+    };
+    for (int i = 1; i < argc; ++i) {
+        std::string argumento = argv[i];
+        std::size_t igual = argumento.find('=');
+        std::string clave = argumento.substr(0, igual);
+        std::string valor = igual == std::string::npos ? "" : argumento.substr(igual + 1);
+        if (clave == "--tamanos") {
+            opciones.tamanos.clear();
+            for (const std::string& parte : separar(valor)) {
+                // std::stod acepta la notación 1e6
+                double tamano = std::stod(parte);
+                if (tamano < 1 || tamano > 1e9) {
+                    throw std::invalid_argument("Tamaño fuera de rango: " + parte);
+                }
+                opciones.tamanos.push_back(static_cast<std::size_t>(tamano));
+            }
+        } else if (clave == "--distribuciones") {
+            opciones.distribuciones.clear();
+            for (const std::string& parte : separar(valor)) {
+                if (parte == "ordenada") opciones.distribuciones.push_back(Distribucion::Ordenada);
+                else if (parte == "aleatoria") opciones.distribuciones.push_back(Distribucion::Aleatoria);
+                else if (parte == "zipf") opciones.distribuciones.push_back(Distribucion::Zipf);
+                else throw std::invalid_argument("Distribución desconocida: " + parte);
+            }
+        } else if (clave == "--filtro") {
+            opciones.filtro = valor;
+        } else if (clave == "--json") {
+            opciones.rutaJson = valor;
+        } else if (clave == "--tiempo-minimo") {
+            opciones.tiempoMinimo = std::stod(valor);
+        } else if (clave == "--semilla") {
+            opciones.semilla = std::stoull(valor);
+        } else {
+            throw std::invalid_argument("Opción desconocida: " + argumento);
+        }
+    }
+    return opciones;
+}
+
+/**
+ * @brief Mide un trabajo ya preparado: lo repite hasta juntar tiempoMinimo segundos (al menos una vez).
+ */
+inline Resultado medir(const Medible& trabajo, double tiempoMinimo, ContadoresHardware& contadores) {
+    Resultado resultado;
+    std::uint64_t asignacionesAntes = asignacionesContadas.load(std::memory_order_relaxed);
+    std::clock_t cpuAntes = std::clock();
+    auto inicio = std::chrono::steady_clock::now();
+    double transcurrido = 0;
+    contadores.iniciar();
+    do {
+        resultado.operaciones += trabajo();
+        ++resultado.repeticiones;
+        transcurrido = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    } while (transcurrido < tiempoMinimo);
+    ContadoresHardware::Lectura lectura = contadores.detener();
+    double segundosCpu = static_cast<double>(std::clock() - cpuAntes) / CLOCKS_PER_SEC;
+    std::uint64_t asignaciones = asignacionesContadas.load(std::memory_order_relaxed) - asignacionesAntes;
+
+    double operaciones = static_cast<double>(std::max<std::uint64_t>(1, resultado.operaciones));
+    resultado.nsPorOperacion = transcurrido * 1e9 / operaciones;
+    resultado.nsCpuPorOperacion = segundosCpu * 1e9 / operaciones;
+    resultado.asignacionesPorOperacion = static_cast<double>(asignaciones) / operaciones;
+    resultado.conContadores = contadores.disponible();
+    resultado.fallosCachePorOperacion = static_cast<double>(lectura.fallosCache) / operaciones;
+    resultado.instruccionesPorOperacion = static_cast<double>(lectura.instrucciones) / operaciones;
+    return resultado;
+}
+
+/**
+ * @brief Escapa una cadena para escribirla dentro de comillas en JSON.
+ */
+inline std::string escaparJson(const std::string& texto) {
+    std::string salida;
+    for (char c : texto) {
+        if (c == '"' || c == '\\') {
+            salida += '\\';
+        }
+        salida += c;
+    }
+    return salida;
+}
+
+/**
+ * @brief Escribe los resultados en el formato JSON de Google Benchmark, con los contadores propios como campos extra.
+ */
+inline void escribirJson(std::ostream& salida, const std::vector<Resultado>& resultados, bool conContadores) {
+    std::time_t ahora = std::time(nullptr);
+    char fecha[64];
+    std::strftime(fecha, sizeof(fecha), "%Y-%m-%dT%H:%M:%S", std::localtime(&ahora));
+    salida << "{\n  \"context\": {\n";
+    salida << "    \"date\": \"" << fecha << "\",\n";
+    salida << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n";
+#ifdef NDEBUG
+    salida << "    \"library_build_type\": \"release\",\n";
+#else
+    salida << "    \"library_build_type\": \"debug\",\n";
+#endif
+    salida << "    \"contadores_hardware\": " << (conContadores ? "true" : "false") << "\n  },\n";
+    salida << "  \"benchmarks\": [\n";
+    for (std::size_t i = 0; i < resultados.size(); ++i) {
+        const Resultado& r = resultados[i];
+        std::string nombre = escaparJson(r.nombre + "/" + nombreDistribucion(r.distribucion) + "/" + std::to_string(r.tamano));
+        salida << "    {\n";
+        salida << "      \"name\": \"" << nombre << "\",\n";
+        salida << "      \"run_name\": \"" << nombre << "\",\n";
+        salida << "      \"run_type\": \"iteration\",\n";
+        salida << "      \"iterations\": " << r.repeticiones << ",\n";
+        salida << "      \"real_time\": " << r.nsPorOperacion << ",\n";
+        salida << "      \"cpu_time\": " << r.nsCpuPorOperacion << ",\n";
+        salida << "      \"time_unit\": \"ns\",\n";
+        salida << "      \"operaciones\": " << r.operaciones << ",\n";
+        salida << "      \"asignaciones_por_op\": " << r.asignacionesPorOperacion;
+        if (r.conContadores) {
+            salida << ",\n      \"fallos_cache_por_op\": " << r.fallosCachePorOperacion;
+            salida << ",\n      \"instrucciones_por_op\": " << r.instruccionesPorOperacion;
+        }
+        salida << "\n    }" << (i + 1 < resultados.size() ? "," : "") << "\n";
+    }
+    salida << "  ]\n}\n";
+}
+
+/**
+ * @brief Corre los casos que pasan el filtro para cada tamaño y distribución, imprime una tabla y,
+ * si se pidió, escribe el JSON.
+ * @return Los resultados, en el orden en que se midieron.
+ */
+inline std::vector<Resultado> correrCasos(const std::vector<Caso>& casos, const Opciones& opciones) {
+    std::regex filtro(opciones.filtro);
+    ContadoresHardware contadores;
+    std::vector<Resultado> resultados;
+
+    std::printf("%-36s %10s %10s %12s %12s", "Caso", "Tamaño", "Claves", "ns/op", "asig/op");
+    if (contadores.disponible()) {
+        std::printf(" %12s %12s", "fallos/op", "instr/op");
+    }
+    std::printf("\n");
+
+    for (const Caso& caso : casos) {
+        if (!std::regex_search(caso.nombre, filtro)) {
+            continue;
+        }
+        for (std::size_t tamano : opciones.tamanos) {
+            for (Distribucion distribucion : opciones.distribuciones) {
+                std::size_t limite = distribucion == Distribucion::Aleatoria ? caso.tamanoMaximo : caso.tamanoMaximoSesgado;
+                if (tamano > limite) {
+                    continue;
+                }
+                std::vector<int> claves = generarClaves(tamano, distribucion, opciones.semilla);
+                Medible trabajo = caso.preparar(claves);
+                Resultado r = medir(trabajo, opciones.tiempoMinimo, contadores);
+                r.nombre = caso.nombre;
+                r.tamano = tamano;
+                r.distribucion = distribucion;
+                std::printf("%-36s %10zu %10s %12.2f %12.3f", r.nombre.c_str(), r.tamano, nombreDistribucion(distribucion),
+                            r.nsPorOperacion, r.asignacionesPorOperacion);
+                if (r.conContadores) {
+                    std::printf(" %12.3f %12.1f", r.fallosCachePorOperacion, r.instruccionesPorOperacion);
+                }
+                std::printf("\n");
+                std::fflush(stdout);
+                resultados.push_back(r);
+            }
+        }
+    }
+
+    if (!opciones.rutaJson.empty()) {
+        std::ofstream archivo(opciones.rutaJson);
+        if (!archivo) {
+            throw std::runtime_error("No se pudo escribir " + opciones.rutaJson + ".");
+        }
+        escribirJson(archivo, resultados, contadores.disponible());
+    }
+    return resultados;
+}
+
+#endif
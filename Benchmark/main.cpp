@@ -0,0 +1,468 @@
+/**
+ * @file main.cpp
+ * @brief Benchmarks de todos los contenedores del repositorio.
+ * Uso: benchmark [--tamanos=1e3,1e4,1e5,1e6,1e7,1e8] [--distribuciones=ordenada,aleatoria,zipf]
+ *                [--filtro=<regex>] [--json=resultados.json] [--tiempo-minimo=0.2] [--semilla=42]
+ * Cada caso indica cuántas operaciones hace por repetición; los tiempos se reportan por operación.
+ * Los casos con sufijo _pool o _arena crean los nodos con RecursoPoolNodos o RecursoMonotono en lugar de std::allocator.
+ */
+#include "Benchmark.hpp"
+#include "../ArbolBinario/Arbol.hpp"
+#include "../ArregloDinamico/ArregloDinamico.hpp"
+#include "../Cola/Cola.hpp"
+#include "../ColaPrioridad/ColaPrioridad.hpp"
+#include "../Grafo/Algoritmos.hpp"
+#include "../Grafo/Centralidad.hpp"
+#include "../Grafo/Grafo.hpp"
+#include "../Grafo/Reordenamiento.hpp"
+#include "../Memoria/Recursos.hpp"
+#include "../ListaDoblementeEnlazada/listaDoble.hpp"
+#include "../ListaEnlazada/Lista.hpp"
+#include "../ListaEnlazada/ListaDesenrollada.hpp"
+#include "../ListaSimplementeEnlazadaCircular/ListaCircular.hpp"
+#include "../Pila/Pila.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <new>
+#include <streambuf>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <malloc.h>
+#endif
+
+// Se reemplaza operator new para contar asignaciones, en sus variantes normal, alineada y nothrow; los new[] y delete
+// sin reemplazar llaman a estas. Todas pasan por las mismas funciones, así que cada delete corresponde con su new
+// (std::stable_sort, por ejemplo, pide su búfer temporal con el new nothrow).
+// GCC no sabe que estos operator new usan malloc y avisa por error que free no corresponde con new.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+namespace {
+
+void* reservarContando(std::size_t bytes) noexcept {
+    asignacionesContadas.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(bytes ? bytes : 1);
+}
+
+void* reservarAlineadoContando(std::size_t bytes, std::align_val_t alineacion) noexcept {
+    asignacionesContadas.fetch_add(1, std::memory_order_relaxed);
+    std::size_t a = static_cast<std::size_t>(alineacion);
+    if (bytes > std::numeric_limits<std::size_t>::max() - a) {
+        return nullptr;
+    }
+#ifdef _MSC_VER
+    // MSVC no tiene std::aligned_alloc; lo reservado con _aligned_malloc se libera con _aligned_free
+    return _aligned_malloc(bytes ? bytes : 1, a);
+#else
+    // aligned_alloc exige que el tamaño sea múltiplo de la alineación
+    return std::aligned_alloc(a, (bytes + a - 1) / a * a + (bytes ? 0 : a));
+#endif
+}
+
+void liberarAlineado(void* memoria) noexcept {
+#ifdef _MSC_VER
+    _aligned_free(memoria);
+#else
+    std::free(memoria);
+#endif
+}
+
+} // namespace
+
+void* operator new(std::size_t bytes) {
+    if (void* memoria = reservarContando(bytes)) {
+        return memoria;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t bytes, const std::nothrow_t&) noexcept {
+    return reservarContando(bytes);
+}
+
+void* operator new(std::size_t bytes, std::align_val_t alineacion) {
+    if (void* memoria = reservarAlineadoContando(bytes, alineacion)) {
+        return memoria;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t bytes, std::align_val_t alineacion, const std::nothrow_t&) noexcept {
+    return reservarAlineadoContando(bytes, alineacion);
+}
+
+void operator delete(void* memoria) noexcept {
+    std::free(memoria);
+}
+
+void operator delete(void* memoria, std::size_t) noexcept {
+    std::free(memoria);
+}
+
+void operator delete(void* memoria, const std::nothrow_t&) noexcept {
+    std::free(memoria);
+}
+
+void operator delete(void* memoria, std::align_val_t) noexcept {
+    liberarAlineado(memoria);
+}
+
+void operator delete(void* memoria, std::size_t, std::align_val_t) noexcept {
+    liberarAlineado(memoria);
+}
+
+void operator delete(void* memoria, std::align_val_t, const std::nothrow_t&) noexcept {
+    liberarAlineado(memoria);
+}
+
+namespace {
+
+/// Evita que el compilador descarte resultados que nadie usa.
+volatile long long sumidero = 0;
+
+/// Descarta todo lo que se escribe; sirve para medir Grafo::BFS sin imprimir.
+class SumideroNulo : public std::streambuf {
+    protected:
+        int overflow(int c) override { return c; }
+        std::streamsize xsputn(const char*, std::streamsize n) override { return n; }
+};
+
+/// Cantidad de búsquedas por repetición en las estructuras de búsqueda lineal.
+const std::size_t BUSQUEDAS = 64;
+
+std::vector<Caso> registrarCasos() {
+    const std::size_t SIN_LIMITE = std::size_t(1) << 40; // Tope de tamaño para los casos que se miden a cualquier tamaño
+    std::vector<Caso> casos;
+
+    casos.push_back({"Pila/push_pop", [](const std::vector<int>& claves) -> Medible {
+        return [&claves] {
+            Pila<int> pila;
+            for (int clave : claves) pila.push(clave);
+            while (!pila.isEmpty()) pila.pop();
+            return static_cast<std::uint64_t>(2 * claves.size());
+        };
+    }, SIN_LIMITE, SIN_LIMITE});
+
+    casos.push_back({"Pila/push_pop_pool", [](const std::vector<int>& claves) -> Medible {
+        auto pool = std::make_shared<RecursoPoolNodos>();
+        return [pool, &claves] {
+            PilaPmr<int> pila(pool.get());
+            for (int clave : claves) pila.push(clave);
+            while (!pila.isEmpty()) pila.pop();
+            return static_cast<std::uint64_t>(2 * claves.size());
+        };
+    }, SIN_LIMITE, SIN_LIMITE});
+
+    casos.push_back({"Cola/encolar_desencolar", [](const std::vector<int>& claves) -> Medible {
+        return [&claves] {
+            Cola<int> cola;
+            for (int clave : claves) cola.encolar(clave);
+            while (!cola.estaVacia()) cola.desencolar();
+            return static_cast<std::uint64_t>(2 * claves.size());
+        };
+    }, SIN_LIMITE, SIN_LIMITE});
+
+    casos.push_back({"ColaPrioridad/encolar_desencolar", [](const std::vector<int>& claves) -> Medible {
+        return [&claves] {
+            ColaPrioridad<int> cola;
+            for (int clave : claves) cola.encolar(clave);
+            long long suma = 0;
+            while (!cola.estaVacia()) {
+                suma += cola.primer();
+                cola.desencolar();
+            }
+            sumidero = sumidero + suma;
+            return static_cast<std::uint64_t>(2 * claves.size());
+        };
+    }, SIN_LIMITE, SIN_LIMITE});
+
+    casos.push_back({"Lista/insertarAlFinal", [](const std::vector<int>& claves) -> Medible {
+        return [&claves] {
+            Lista<int> lista;
+            for (int clave : claves) lista.insertarAlFinal(clave);
+            return static_cast<std::uint64_t>(claves.size());
+        };
+    }, SIN_LIMITE, SIN_LIMITE});
+
+    casos.push_back({"Lista/insertarAlFinal_pool", [](const std::vector<int>& claves) -> Medible {
+        auto pool = std::make_shared<RecursoPoolNodos>();
+        return [pool, &claves] {
+            ListaPmr<int> lista(pool.get());
+            for (int clave : claves) lista.insertarAlFinal(clave);
+            return static_cast<std::uint64_t>(claves.size());
+        };
+    }, SIN_LIMITE, SIN_LIMITE});
+
+    casos.push_back({"Lista/insertarAlFinal_arena", [](const std::vector<int>& claves) -> Medible {
+        auto arena = std::make_shared<RecursoMonotono>();
+        return [arena, &claves] {
+            {
+                ListaPmr<int> lista(arena.get());
+                for (int clave : claves) lista.insertarAlFinal(clave);
+            }
+            arena->reiniciar();
+            return static_cast<std::uint64_t>(claves.size());
+        };
+    }, SIN_LIMITE, SIN_LIMITE});
+
+    casos.push_back({"Lista/buscar", [](const std::vector<int>& claves) -> Medible {
+        auto lista = std::make_shared<Lista<int>>();
+        for (int clave : claves) lista->insertarAlFinal(clave);
+        return [lista, &claves] {
+            long long suma = 0;
+            for (std::size_t i = 0; i < BUSQUEDAS; ++i) {
+                suma += lista->buscar(claves[(i * 7919) % claves.size()]);
+            }
+            sumidero = sumidero + suma;
+            return static_cast<std::uint64_t>(BUSQUEDAS);
+        };
+    }, 1000000, 1000000});
+
+    casos.push_back({"ListaDesenrollada/insertarAlFinal", [](const std::vector<int>& claves) -> Medible {
+        return [&claves] {
+            ListaDesenrollada<int> lista;
+            for (int clave : claves) lista.insertarAlFinal(clave);
+            return static_cast<std::uint64_t>(claves.size());
+        };
+    }, SIN_LIMITE, SIN_LIMITE});
+
+    casos.push_back({"ListaDesenrollada/buscar", [](const std::vector<int>& claves) -> Medible {
+        auto lista = std::make_shared<ListaDesenrollada<int>>();
+        for (int clave : claves) lista->insertarAlFinal(clave);
+        return [lista, &claves] {
+            long long suma = 0;
+            for (std::size_t i = 0; i < BUSQUEDAS; ++i) {
+                suma += lista->buscar(claves[(i * 7919) % claves.size()]);
+            }
+            sumidero = sumidero + suma;
+            return static_cast<std::uint64_t>(BUSQUEDAS);
+        };
+    }, 1000000, 1000000});
+
+    casos.push_back({"ListaDoble/insertar_eliminar", [](const std::vector<int>& claves) -> Medible {
+        return [&claves] {
+            ListaDoble<int> lista;
+            for (int clave : claves) lista.insertarAlFinal(clave);
+            while (lista.obtenerTamano() > 0) lista.eliminar(lista.begin());
+            return static_cast<std::uint64_t>(2 * claves.size());
+        };
+    }, SIN_LIMITE, SIN_LIMITE});
+
+    casos.push_back({"ListaDoble/buscar", [](const std::vector<int>& claves) -> Medible {
+        auto lista = std::make_shared<ListaDoble<int>>();
+        for (int clave : claves) lista->insertarAlFinal(clave);
+        return [lista, &claves] {
+            long long suma = 0;
+            for (std::size_t i = 0; i < BUSQUEDAS; ++i) {
+                suma += lista->buscar(claves[(i * 7919) % claves.size()]);
+            }
+            sumidero = sumidero + suma;
+            return static_cast<std::uint64_t>(BUSQUEDAS);
+        };
+    }, 1000000, 1000000});
+
+    casos.push_back({"ListaCircular/insertar_girar", [](const std::vector<int>& claves) -> Medible {
+        return [&claves] {
+            ListaCircular<int> lista;
+            for (int clave : claves) lista.insertar(clave);
+            long long suma = 0;
+            for (std::size_t i = 0; i < claves.size(); ++i) {
+                suma += lista.actual();
+                lista.avanzar();
+            }
+            sumidero = sumidero + suma;
+            return static_cast<std::uint64_t>(2 * claves.size());
+        };
+    }, SIN_LIMITE, SIN_LIMITE});
+
+    // Con claves ordenadas (o muy repetidas, como en zipf) el árbol degenera en una lista:
+    // inserciones O(n) y recursión tan profunda como n
+    casos.push_back({"Arbol/insertar", [](const std::vector<int>& claves) -> Medible {
+        return [&claves] {
+            Arbol<int> arbol;
+            for (int clave : claves) arbol.insertar(clave);
+            return static_cast<std::uint64_t>(claves.size());
+        };
+    }, SIN_LIMITE, 10000});
+
+    casos.push_back({"Arbol/buscar", [](const std::vector<int>& claves) -> Medible {
+        auto arbol = std::make_shared<Arbol<int>>();
+        for (int clave : claves) arbol->insertar(clave);
+        return [arbol, &claves] {
+            long long encontrados = 0;
+            for (int clave : claves) encontrados += arbol->buscar(clave) != nullptr;
+            sumidero = sumidero + encontrados;
+            return static_cast<std::uint64_t>(claves.size());
+        };
+    }, SIN_LIMITE, 10000});
+
+    casos.push_back({"Arbol/insertar_pool", [](const std::vector<int>& claves) -> Medible {
+        auto pool = std::make_shared<RecursoPoolNodos>();
+        return [pool, &claves] {
+            ArbolPmr<int> arbol(pool.get());
+            for (int clave : claves) arbol.insertar(clave);
+            return static_cast<std::uint64_t>(claves.size());
+        };
+    }, SIN_LIMITE, 10000});
+
+    // agregarArista busca cada extremo recorriendo todos los vértices: construir cuesta O(n^2)
+    casos.push_back({"Grafo/construir", [](const std::vector<int>& claves) -> Medible {
+        return [&claves] {
+            Grafo<int> grafo;
+            const int n = static_cast<int>(claves.size());
+            for (int i = 0; i < n; ++i) grafo.agregarVertice(i);
+            for (int i = 0; i + 1 < n; ++i) grafo.agregarArista(claves[i], claves[i + 1]);
+            return static_cast<std::uint64_t>(2 * claves.size() - 1);
+        };
+    }, 10000, 10000});
+
+    casos.push_back({"Grafo/BFS", [](const std::vector<int>& claves) -> Medible {
+        auto grafo = std::make_shared<Grafo<int>>();
+        const int n = static_cast<int>(claves.size());
+        for (int i = 0; i < n; ++i) grafo->agregarVertice(i);
+        for (int i = 0; i + 1 < n; ++i) grafo->agregarArista(claves[i], claves[i + 1]);
+        auto sumideroNulo = std::make_shared<SumideroNulo>();
+        return [grafo, sumideroNulo, &claves] {
+            std::streambuf* anterior = std::cout.rdbuf(sumideroNulo.get());
+            grafo->BFS(claves[0]);
+            std::cout.rdbuf(anterior);
+            return static_cast<std::uint64_t>(claves.size());
+        };
+    }, 10000, 10000});
+
+    // Grafo dirigido de n vértices con 4 aristas por vértice, armado directamente como instantánea CSR
+    auto grafoAleatorio = [](const std::vector<int>& claves) {
+        const std::size_t n = claves.size();
+        std::vector<std::pair<IdVertice, IdVertice>> aristas;
+        aristas.reserve(4 * n);
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t k = 1; k <= 4; ++k) {
+                aristas.push_back({static_cast<IdVertice>(i), static_cast<IdVertice>(claves[(i * k + k) % n]) % static_cast<IdVertice>(n)});
+            }
+        }
+        return std::make_shared<GrafoCsr>(GrafoCsr::desdeAristas(n, aristas, true));
+    };
+
+    casos.push_back({"GrafoCsr/componentesFuertes", [grafoAleatorio](const std::vector<int>& claves) -> Medible {
+        auto grafo = grafoAleatorio(claves);
+        return [grafo] {
+            sumidero = sumidero + static_cast<long long>(componentesFuertes(*grafo).cantidad);
+            return static_cast<std::uint64_t>(grafo->numeroVertices() + grafo->numeroAristas());
+        };
+    }, SIN_LIMITE, SIN_LIMITE});
+
+    casos.push_back({"GrafoCsr/ordenTopologico", [grafoAleatorio](const std::vector<int>& claves) -> Medible {
+        auto grafo = grafoAleatorio(claves);
+        return [grafo] {
+            sumidero = sumidero + static_cast<long long>(ordenTopologico(*grafo).orden.size());
+            return static_cast<std::uint64_t>(grafo->numeroVertices() + grafo->numeroAristas());
+        };
+    }, SIN_LIMITE, SIN_LIMITE});
+
+    // Una iteración de PageRank por repetición; se cuenta una operación por arista
+    casos.push_back({"GrafoCsr/pageRank_iteracion", [grafoAleatorio](const std::vector<int>& claves) -> Medible {
+        auto grafo = grafoAleatorio(claves);
+        auto calculadora = std::make_shared<CalculadoraPageRank>(*grafo);
+        return [grafo, calculadora] {
+            OpcionesPageRank opciones;
+            opciones.maximoIteraciones = 1;
+            sumidero = sumidero + static_cast<long long>(calculadora->calcular(opciones).iteraciones);
+            return static_cast<std::uint64_t>(grafo->numeroAristas());
+        };
+    }, SIN_LIMITE, SIN_LIMITE});
+
+    // Malla no dirigida de lado ~sqrt(n) cuyos vértices se numeran en el orden de las claves: con claves aleatorias
+    // los vecinos de cada celda quedan dispersos, como en un grafo cargado en orden de inserción
+    auto mallaNumerada = [](const std::vector<int>& claves) {
+        const std::size_t n = claves.size();
+        std::size_t lado = 1;
+        while ((lado + 1) * (lado + 1) <= n) ++lado;
+        std::vector<IdVertice> celdas(n);
+        for (std::size_t i = 0; i < n; ++i) celdas[i] = static_cast<IdVertice>(i);
+        std::stable_sort(celdas.begin(), celdas.end(), [&claves](IdVertice a, IdVertice b) { return claves[a] < claves[b]; });
+        std::vector<IdVertice> etiqueta(n);
+        for (std::size_t i = 0; i < n; ++i) etiqueta[celdas[i]] = static_cast<IdVertice>(i);
+        std::vector<std::pair<IdVertice, IdVertice>> aristas;
+        aristas.reserve(2 * n);
+        for (std::size_t c = 0; c < n; ++c) {
+            if ((c + 1) % lado != 0 && c + 1 < n) aristas.push_back({etiqueta[c], etiqueta[c + 1]});
+            if (c + lado < n) aristas.push_back({etiqueta[c], etiqueta[c + lado]});
+        }
+        return std::make_shared<GrafoCsr>(GrafoCsr::desdeAristas(n, aristas, false));
+    };
+
+    // Recorrido en anchura completo de una instantánea con arreglos densos; se cuenta una operación por arista
+    auto recorrerEnAnchura = [](const GrafoCsr& grafo) -> Medible {
+        auto visitado = std::make_shared<std::vector<std::uint8_t>>();
+        auto cola = std::make_shared<std::vector<IdVertice>>();
+        return [&grafo, visitado, cola] {
+            visitado->assign(grafo.numeroVertices(), 0);
+            cola->clear();
+            for (std::size_t raiz = 0; raiz < grafo.numeroVertices(); ++raiz) {
+                if ((*visitado)[raiz]) continue;
+                (*visitado)[raiz] = 1;
+                cola->push_back(static_cast<IdVertice>(raiz));
+                for (std::size_t cabeza = cola->size() - 1; cabeza < cola->size(); ++cabeza) {
+                    for (IdVertice w : grafo.vecinos((*cola)[cabeza])) {
+                        if (!(*visitado)[w]) {
+                            (*visitado)[w] = 1;
+                            cola->push_back(w);
+                        }
+                    }
+                }
+            }
+            sumidero = sumidero + static_cast<long long>(cola->back());
+            return static_cast<std::uint64_t>(grafo.numeroAristas());
+        };
+    };
+
+    casos.push_back({"GrafoCsr/BFS_malla", [mallaNumerada, recorrerEnAnchura](const std::vector<int>& claves) -> Medible {
+        auto grafo = mallaNumerada(claves);
+        Medible recorrer = recorrerEnAnchura(*grafo);
+        return [grafo, recorrer] { return recorrer(); };
+    }, SIN_LIMITE, SIN_LIMITE});
+
+    // La misma malla renumerada con Cuthill-McKee inverso: los vecinos quedan a unas sqrt(n) posiciones
+    casos.push_back({"GrafoCsr/BFS_malla_rcm", [mallaNumerada, recorrerEnAnchura](const std::vector<int>& claves) -> Medible {
+        auto original = mallaNumerada(claves);
+        auto grafo = std::make_shared<GrafoCsr>(
+            permutar(*original, calcularPermutacion(*original, CriterioOrden::CuthillMcKeeInverso)));
+        Medible recorrer = recorrerEnAnchura(*grafo);
+        return [grafo, recorrer] { return recorrer(); };
+    }, SIN_LIMITE, SIN_LIMITE});
+
+    casos.push_back({"ArregloDinamico/agregar", [](const std::vector<int>& claves) -> Medible {
+        return [&claves] {
+            ArregloDinamico<int> arreglo;
+            for (int clave : claves) arreglo.agregar(clave);
+            sumidero = sumidero + arreglo.ultimo();
+            return static_cast<std::uint64_t>(claves.size());
+        };
+    }, SIN_LIMITE, SIN_LIMITE});
+
+    casos.push_back({"std::vector/push_back", [](const std::vector<int>& claves) -> Medible {
+        return [&claves] {
+            std::vector<int> arreglo;
+            for (int clave : claves) arreglo.push_back(clave);
+            sumidero = sumidero + arreglo.back();
+            return static_cast<std::uint64_t>(claves.size());
+        };
+    }, SIN_LIMITE, SIN_LIMITE});
+
+    return casos;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    try {
+        Opciones opciones = leerOpciones(argc, argv);
+        correrCasos(registrarCasos(), opciones);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
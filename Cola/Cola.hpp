@@ -3,29 +3,74 @@
  * @brief Definición de la clase Cola para una cola genérica.
  * Esta clase implementa una cola utilizando punteros inteligentes para manejar la memoria de manera segura.
  * Permite operaciones básicas como encolar, desencolar y verificar si la cola está vacía
+ * Los nodos se crean con un asignador configurable, de modo que la cola puede vivir en una arena o en un pool.
  */
 #ifndef COLA_HPP
 #define COLA_HPP
-#include "Nodo.hpp"
+#include "NodoCola.hpp"
+#include "../Instrumentacion/Instrumentacion.hpp"
 #include <memory>
+#include <memory_resource>
 #include <iostream>
 
-template<typename T>
+template<typename T, typename Instrumentacion = SinInstrumentacion, typename Asignador = std::allocator<T>>
 
 /**
  * @class Cola
  * @brief Clase que representa una cola genérica.
+ * @tparam Instrumentacion Política de instrumentación; por defecto no mide nada.
+ * @tparam Asignador Asignador de los nodos: `std::allocator` o compatible, o `std::pmr::polymorphic_allocator`.
  */
 class Cola {
     private:
-        std::unique_ptr<Nodo<T>> frente;
-        Nodo<T>* final;
+        GestorNodos<NodoCola<T, Asignador>, Asignador> gestor;
+        PunteroNodo<NodoCola<T, Asignador>, Asignador> frente;
+        NodoCola<T, Asignador>* final;
     public:
         /**
          * @brief Constructor de la clase Cola.
          * Inicializa una cola vacía.
+         * @param asignador Asignador del que se pedirán los nodos.
          */
-        Cola() : frente(nullptr), final(nullptr) {}
+        explicit Cola(const Asignador& asignador = Asignador()) : gestor(asignador), frente(nullptr), final(nullptr) {}
+
+        /**
+         * @brief Destructor de la cola; libera los nodos de forma iterativa con limpiar().
+         */
+        ~Cola() {
+            limpiar();
+        }
+
+        Cola(const Cola&) = delete;
+        Cola& operator=(const Cola&) = delete;
+
+        /**
+         * @brief Constructor de movimiento: toma los nodos y el asignador de otra cola, que queda vacía.
+         */
+        Cola(Cola&& otra) noexcept : gestor(otra.gestor), frente(std::move(otra.frente)), final(otra.final) {
+            otra.final = nullptr;
+        }
+
+        /**
+         * @brief Asignación por movimiento: libera los nodos propios y toma los de otra cola.
+         * Los nodos tomados vuelven al asignador de la otra cola cuando se liberan.
+         */
+        Cola& operator=(Cola&& otra) noexcept {
+            if (this != &otra) {
+                limpiar();
+                frente = std::move(otra.frente);
+                final = otra.final;
+                otra.final = nullptr;
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Devuelve una copia del asignador con el que se crean los nodos.
+         */
+        Asignador obtenerAsignador() const {
+            return gestor.obtenerAsignador();
+        }
 
         /**
          * @brief Encola un nuevo elemento al final de la cola.
@@ -35,8 +80,10 @@ class Cola {
          * Si la cola no está vacía, el nuevo nodo se agrega al final y se actualiza el puntero final.
          */
         void encolar(const T& valor) {
-            auto nuevoNodo = std::make_unique<Nodo<T>>(valor);
-            Nodo<T>* nuevoPtr = nuevoNodo.get();
+            typename Instrumentacion::Temporizador medir("cola_encolar");
+            Instrumentacion::asignacion();
+            auto nuevoNodo = gestor.crear(valor);
+            NodoCola<T, Asignador>* nuevoPtr = nuevoNodo.get();
             if (!frente) {
                 frente = std::move(nuevoNodo);
                 final = frente.get();
@@ -52,6 +99,7 @@ class Cola {
          * Si la cola está vacía, no realiza ninguna acción.
          */
         void desencolar() {
+            typename Instrumentacion::Temporizador medir("cola_desencolar");
             if (!frente) {
                 std::cout << "La cola está vacía. No se puede desencolar." << std::endl;
                 return;
@@ -80,6 +128,20 @@ class Cola {
         bool estaVacia() const {
             return !frente;
         }
+
+        /**
+         * @brief Elimina todos los elementos, uno por uno desde el frente para no encadenar destructores.
+         */
+        void limpiar() {
+            while (frente) {
+                frente = std::move(frente->siguiente);
+            }
+            final = nullptr;
+        }
 };
 
+/// Cola cuyos nodos se piden a un `std::pmr::memory_resource`, por ejemplo RecursoMonotono o RecursoPoolNodos.
+template <typename T, typename Instrumentacion = SinInstrumentacion>
+using ColaPmr = Cola<T, Instrumentacion, std::pmr::polymorphic_allocator<T>>;
+
 #endif
\ No newline at end of file
@@ -0,0 +1,25 @@
+/**
+ * @file NodoCola.hpp
+ * @brief Definición de la clase NodoCola para una cola.
+ * Esta clase es parte de una implementación de una cola genérica.
+ * Utiliza punteros inteligentes para manejar la memoria de manera segura.
+ */
+#ifndef NODOCOLA_HPP
+#define NODOCOLA_HPP
+
+#include "../Memoria/GestorNodos.hpp"
+#include <memory>
+
+/**
+ * @tparam Asignador Asignador con el que la cola crea sus nodos; el enlace lo usa para liberar el siguiente nodo.
+ */
+template<typename T, typename Asignador = std::allocator<T>>
+class NodoCola {
+public:
+    T dato;
+    PunteroNodo<NodoCola<T, Asignador>, Asignador> siguiente;
+
+    NodoCola(const T& valor) : dato(valor), siguiente(nullptr) {}
+};
+
+#endif
@@ -0,0 +1,186 @@
+/**
+ * @file ColaPrioridad.hpp
+ * @brief Definición de la clase ColaPrioridad basada en un montículo d-ario implícito.
+ * Esta clase complementa a Cola (FIFO) y Pila (LIFO) con un orden por prioridad.
+ * Los elementos se guardan contiguos en un std::vector, sin nodos ni punteros, lo que aprovecha mejor la caché.
+ */
+#ifndef COLAPRIORIDAD_HPP
+#define COLAPRIORIDAD_HPP
+
+#include <vector>
+#include <functional>
+#include <stdexcept>
+#include <iostream>
+#include <utility>
+#include <cstddef>
+
+/**
+ * @class ColaPrioridad
+ * @brief Cola de prioridad implementada como un montículo d-ario implícito.
+ *
+ * El árbol no se guarda con punteros: el nodo en la posición i tiene a sus hijos en las posiciones
+ * D*i + 1 ... D*i + D y a su padre en (i - 1) / D.
+ * Con una aridad D mayor el árbol es más bajo (menos niveles al desencolar y encolar) y los hijos de un nodo
+ * quedan en la misma línea de caché, a cambio de más comparaciones por nivel al bajar.
+ * Por defecto es un montículo de mínimos: sale primero el elemento que el comparador considera "menor".
+ * @tparam T Tipo de dato almacenado en la cola.
+ * @tparam D Aridad del montículo (número de hijos por nodo), debe ser al menos 2.
+ * @tparam Comparador Función que devuelve true si el primer argumento tiene más prioridad que el segundo.
+ */
+template <typename T, std::size_t D = 4, typename Comparador = std::less<T>>
+class ColaPrioridad {
+    static_assert(D >= 2, "La aridad del montículo debe ser al menos 2.");
+
+    private:
+        std::vector<T> datos; ///< Elementos del montículo en orden por niveles.
+        Comparador comparar;  ///< Criterio de prioridad.
+
+        /**
+         * @brief Sube un elemento hasta que su padre tenga igual o más prioridad.
+         * @param indice Posición del elemento a subir.
+         * En lugar de intercambiar en cada nivel, se guarda el elemento aparte y se van bajando los padres,
+         * así cada nivel cuesta un solo movimiento.
+         */
+        void subir(std::size_t indice) {
+            T elemento = std::move(datos[indice]);
+            while (indice > 0) {
+                std::size_t padre = (indice - 1) / D;
+                if (!comparar(elemento, datos[padre])) {
+                    break;
+                }
+                datos[indice] = std::move(datos[padre]);
+                indice = padre;
+            }
+            datos[indice] = std::move(elemento);
+        }
+
+        /**
+         * @brief Baja un elemento hasta que tenga más prioridad que todos sus hijos.
+         * @param indice Posición del elemento a bajar.
+         * En cada nivel se busca el hijo con más prioridad entre los D hijos contiguos.
+         */
+        void bajar(std::size_t indice) {
+            const std::size_t n = datos.size();
+            T elemento = std::move(datos[indice]);
+            while (true) {
+                std::size_t primerHijo = D * indice + 1;
+                if (primerHijo >= n) {
+                    break;
+                }
+                std::size_t ultimoHijo = primerHijo + D < n ? primerHijo + D : n;
+                std::size_t mejor = primerHijo;
+                for (std::size_t hijo = primerHijo + 1; hijo < ultimoHijo; ++hijo) {
+                    if (comparar(datos[hijo], datos[mejor])) {
+                        mejor = hijo;
+                    }
+                }
+                if (!comparar(datos[mejor], elemento)) {
+                    break;
+                }
+                datos[indice] = std::move(datos[mejor]);
+                indice = mejor;
+            }
+            datos[indice] = std::move(elemento);
+        }
+
+    public:
+        /**
+         * @brief Constructor de la clase ColaPrioridad.
+         * Inicializa una cola de prioridad vacía.
+         */
+        explicit ColaPrioridad(const Comparador& comp = Comparador()) : comparar(comp) {}
+
+        /**
+         * @brief Construye la cola a partir de un lote de elementos.
+         * @param elementos Elementos iniciales, en cualquier orden.
+         * Equivale a llamar a construir(), es decir, heapify en O(n) en lugar de n inserciones en O(n log n).
+         */
+        explicit ColaPrioridad(std::vector<T> elementos, const Comparador& comp = Comparador()) : comparar(comp) {
+            construir(std::move(elementos));
+        }
+
+        /**
+         * @brief Reemplaza el contenido de la cola por un lote de elementos.
+         * @param elementos Elementos a organizar como montículo.
+         * Usa el algoritmo de Floyd: se baja cada nodo interno empezando por el último, lo que cuesta O(n).
+         */
+        void construir(std::vector<T> elementos) {
+            datos = std::move(elementos);
+            if (datos.size() < 2) {
+                return;
+            }
+            for (std::size_t i = (datos.size() - 2) / D + 1; i-- > 0;) {
+                bajar(i);
+            }
+        }
+
+        /**
+         * @brief Encola un nuevo elemento según su prioridad.
+         * @param valor El valor a encolar.
+         */
+        void encolar(const T& valor) {
+            datos.push_back(valor);
+            subir(datos.size() - 1);
+        }
+
+        /**
+         * @brief Desencola el elemento con mayor prioridad.
+         * Si la cola está vacía, no realiza ninguna acción.
+         */
+        void desencolar() {
+            if (datos.empty()) {
+                std::cout << "La cola de prioridad está vacía. No se puede desencolar." << std::endl;
+                return;
+            }
+            datos.front() = std::move(datos.back());
+            datos.pop_back();
+            if (!datos.empty()) {
+                bajar(0);
+            }
+        }
+
+        /**
+         * @brief Devuelve el elemento con mayor prioridad sin eliminarlo.
+         * @return Referencia constante al elemento del frente.
+         * @throws std::runtime_error Si la cola está vacía.
+         */
+        const T& primer() const {
+            if (datos.empty()) {
+                throw std::runtime_error("La cola de prioridad está vacía. No hay elementos para mostrar.");
+            }
+            return datos.front();
+        }
+
+        /**
+         * @brief Reserva espacio para al menos la cantidad indicada de elementos.
+         * @param capacidad Número de elementos esperados.
+         */
+        void reservar(std::size_t capacidad) {
+            datos.reserve(capacidad);
+        }
+
+        /**
+         * @brief Verifica si la cola está vacía.
+         * @return true si la cola está vacía, false en caso contrario.
+         */
+        bool estaVacia() const {
+            return datos.empty();
+        }
+
+        /**
+         * @brief Devuelve el número de elementos en la cola.
+         * @return Tamaño de la cola.
+         */
+        std::size_t tamano() const {
+            return datos.size();
+        }
+
+        /**
+         * @brief Elimina todos los elementos de la cola.
+         */
+        void limpiar() {
+            datos.clear();
+        }
+};
+
+#endif
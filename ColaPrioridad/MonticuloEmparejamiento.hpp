@@ -0,0 +1,248 @@
+/**
+ * @file MonticuloEmparejamiento.hpp
+ * @brief Definición de la clase MonticuloEmparejamiento (pairing heap).
+ * Cola de prioridad basada en nodos que permite disminuir la clave de un elemento ya encolado,
+ * operación necesaria en algoritmos como Dijkstra o Prim.
+ */
+#ifndef MONTICULOEMPAREJAMIENTO_HPP
+#define MONTICULOEMPAREJAMIENTO_HPP
+
+#include "NodoEmparejamiento.hpp"
+#include <memory>
+#include <vector>
+#include <functional>
+#include <stdexcept>
+#include <iostream>
+#include <cstddef>
+
+/**
+ * @class MonticuloEmparejamiento
+ * @brief Montículo de emparejamiento con manejadores para disminuir claves.
+ *
+ * encolar() y fusionar() cuestan O(1), primer() O(1), y desencolar() O(log n) amortizado.
+ * encolar() devuelve un puntero al nodo creado que sirve como manejador para disminuirClave();
+ * el puntero es válido mientras el elemento siga en el montículo.
+ * @tparam T Tipo de dato almacenado.
+ * @tparam Comparador Función que devuelve true si el primer argumento tiene más prioridad que el segundo.
+ */
+template <typename T, typename Comparador = std::less<T>>
+class MonticuloEmparejamiento {
+    public:
+        using Manejador = NodoEmparejamiento<T>*;
+
+    private:
+        std::unique_ptr<NodoEmparejamiento<T>> raiz; ///< Nodo con mayor prioridad.
+        std::size_t cantidad;                        ///< Número de elementos.
+        Comparador comparar;                         ///< Criterio de prioridad.
+
+        /**
+         * @brief Enlaza dos raíces: la de menor prioridad pasa a ser el primer hijo de la otra.
+         * @param a Primera raíz (sin hermanos).
+         * @param b Segunda raíz (sin hermanos).
+         * @return La raíz resultante.
+         */
+        std::unique_ptr<NodoEmparejamiento<T>> enlazar(std::unique_ptr<NodoEmparejamiento<T>> a,
+                                                       std::unique_ptr<NodoEmparejamiento<T>> b) {
+            if (!a) return b;
+            if (!b) return a;
+            if (comparar(b->dato, a->dato)) {
+                std::swap(a, b);
+            }
+            // b se vuelve el primer hijo de a; el antiguo primer hijo de a pasa a ser hermano de b
+            b->hermano = std::move(a->hijo);
+            if (b->hermano) {
+                b->hermano->anterior = b.get();
+            }
+            b->anterior = a.get();
+            a->hijo = std::move(b);
+            return a;
+        }
+
+        /**
+         * @brief Fusiona una lista de hermanos en un solo árbol con el método de dos pasadas.
+         * @param primero Primer nodo de la lista de hermanos.
+         * @return La raíz del árbol resultante.
+         * Primera pasada: se enlazan los hermanos de dos en dos, de izquierda a derecha.
+         * Segunda pasada: se enlazan los resultados de derecha a izquierda.
+         * Se hace de forma iterativa para no agotar la pila con listas de hermanos largas.
+         */
+        std::unique_ptr<NodoEmparejamiento<T>> fusionarPares(std::unique_ptr<NodoEmparejamiento<T>> primero) {
+            std::vector<std::unique_ptr<NodoEmparejamiento<T>>> pares;
+            while (primero) {
+                std::unique_ptr<NodoEmparejamiento<T>> a = std::move(primero);
+                primero = std::move(a->hermano);
+                a->anterior = nullptr;
+                if (primero) {
+                    std::unique_ptr<NodoEmparejamiento<T>> b = std::move(primero);
+                    primero = std::move(b->hermano);
+                    b->anterior = nullptr;
+                    pares.push_back(enlazar(std::move(a), std::move(b)));
+                } else {
+                    pares.push_back(std::move(a));
+                }
+            }
+            if (pares.empty()) {
+                return nullptr;
+            }
+            std::unique_ptr<NodoEmparejamiento<T>> resultado = std::move(pares.back());
+            for (std::size_t i = pares.size() - 1; i-- > 0;) {
+                resultado = enlazar(std::move(pares[i]), std::move(resultado));
+            }
+            return resultado;
+        }
+
+    public:
+        /**
+         * @brief Constructor de la clase MonticuloEmparejamiento.
+         * Inicializa un montículo vacío.
+         */
+        explicit MonticuloEmparejamiento(const Comparador& comp = Comparador())
+            : raiz(nullptr), cantidad(0), comparar(comp) {}
+
+        /**
+         * @brief Destructor que libera los nodos de forma iterativa.
+         * La destrucción recursiva de `std::unique_ptr` podría desbordar la pila con montículos grandes.
+         */
+        ~MonticuloEmparejamiento() {
+            limpiar();
+        }
+
+        MonticuloEmparejamiento(const MonticuloEmparejamiento&) = delete;
+        MonticuloEmparejamiento& operator=(const MonticuloEmparejamiento&) = delete;
+
+        /**
+         * @brief Encola un nuevo elemento.
+         * @param valor El valor a encolar.
+         * @return Manejador del nodo creado, para usarlo con disminuirClave().
+         */
+        Manejador encolar(const T& valor) {
+            auto nuevoNodo = std::make_unique<NodoEmparejamiento<T>>(valor);
+            Manejador manejador = nuevoNodo.get();
+            raiz = enlazar(std::move(raiz), std::move(nuevoNodo));
+            cantidad++;
+            return manejador;
+        }
+
+        /**
+         * @brief Construye el montículo a partir de un lote de elementos.
+         * @param elementos Elementos a encolar.
+         * Los nodos se crean como una sola lista de hermanos y se fusionan con una única pasada en dos fases, en O(n).
+         */
+        void construir(const std::vector<T>& elementos) {
+            std::unique_ptr<NodoEmparejamiento<T>> lista = std::move(raiz);
+            for (const T& valor : elementos) {
+                auto nuevoNodo = std::make_unique<NodoEmparejamiento<T>>(valor);
+                nuevoNodo->hermano = std::move(lista);
+                if (nuevoNodo->hermano) {
+                    nuevoNodo->hermano->anterior = nuevoNodo.get();
+                }
+                lista = std::move(nuevoNodo);
+            }
+            cantidad += elementos.size();
+            raiz = fusionarPares(std::move(lista));
+        }
+
+        /**
+         * @brief Devuelve el elemento con mayor prioridad sin eliminarlo.
+         * @return Referencia constante al elemento del frente.
+         * @throws std::runtime_error Si el montículo está vacío.
+         */
+        const T& primer() const {
+            if (!raiz) {
+                throw std::runtime_error("El montículo está vacío. No hay elementos para mostrar.");
+            }
+            return raiz->dato;
+        }
+
+        /**
+         * @brief Elimina el elemento con mayor prioridad.
+         * Si el montículo está vacío, no realiza ninguna acción.
+         */
+        void desencolar() {
+            if (!raiz) {
+                std::cout << "El montículo está vacío. No se puede desencolar." << std::endl;
+                return;
+            }
+            std::unique_ptr<NodoEmparejamiento<T>> hijos = std::move(raiz->hijo);
+            raiz = fusionarPares(std::move(hijos));
+            cantidad--;
+        }
+
+        /**
+         * @brief Aumenta la prioridad de un elemento ya encolado.
+         * @param nodo Manejador devuelto por encolar().
+         * @param nuevoValor Nuevo valor, con prioridad igual o mayor que la actual.
+         * @throws std::invalid_argument Si el nuevo valor tiene menos prioridad que el actual.
+         * El subárbol del nodo se desprende de su padre y se enlaza con la raíz, en O(1).
+         */
+        void disminuirClave(Manejador nodo, const T& nuevoValor) {
+            if (comparar(nodo->dato, nuevoValor)) {
+                throw std::invalid_argument("La nueva clave tiene menos prioridad que la actual.");
+            }
+            nodo->dato = nuevoValor;
+            if (nodo == raiz.get()) {
+                return;
+            }
+            // El dueño del nodo es el campo hijo de su padre o el campo hermano de su hermano anterior
+            NodoEmparejamiento<T>* previo = nodo->anterior;
+            std::unique_ptr<NodoEmparejamiento<T>>& duenio = (previo->hijo.get() == nodo) ? previo->hijo : previo->hermano;
+            std::unique_ptr<NodoEmparejamiento<T>> subarbol = std::move(duenio);
+            duenio = std::move(subarbol->hermano);
+            if (duenio) {
+                duenio->anterior = previo;
+            }
+            subarbol->anterior = nullptr;
+            raiz = enlazar(std::move(raiz), std::move(subarbol));
+        }
+
+        /**
+         * @brief Mueve todos los elementos de otro montículo a este, en O(1).
+         * @param otro Montículo que queda vacío tras la fusión.
+         */
+        void fusionar(MonticuloEmparejamiento& otro) {
+            if (this == &otro) return;
+            raiz = enlazar(std::move(raiz), std::move(otro.raiz));
+            cantidad += otro.cantidad;
+            otro.cantidad = 0;
+        }
+
+        /**
+         * @brief Verifica si el montículo está vacío.
+         * @return true si está vacío, false en caso contrario.
+         */
+        bool estaVacia() const {
+            return !raiz;
+        }
+
+        /**
+         * @brief Devuelve el número de elementos en el montículo.
+         * @return Tamaño del montículo.
+         */
+        std::size_t tamano() const {
+            return cantidad;
+        }
+
+        /**
+         * @brief Elimina todos los elementos.
+         * Los nodos se desprenden uno a uno en una pila explícita para que cada destrucción sea de un nodo sin hijos ni hermanos.
+         */
+        void limpiar() {
+            std::vector<std::unique_ptr<NodoEmparejamiento<T>>> pendientes;
+            if (raiz) {
+                pendientes.push_back(std::move(raiz));
+            }
+            while (!pendientes.empty()) {
+                std::unique_ptr<NodoEmparejamiento<T>> nodo = std::move(pendientes.back());
+                pendientes.pop_back();
+                if (nodo->hijo) {
+                    pendientes.push_back(std::move(nodo->hijo));
+                }
+                if (nodo->hermano) {
+                    pendientes.push_back(std::move(nodo->hermano));
+                }
+            }
+            cantidad = 0;
+        }
+};
+
+#endif
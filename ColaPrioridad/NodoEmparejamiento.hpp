@@ -0,0 +1,28 @@
+/**
+ * @file NodoEmparejamiento.hpp
+ * @brief Definición del nodo de un montículo de emparejamiento.
+ * Utiliza la representación hijo-izquierdo / hermano-derecho con punteros inteligentes.
+ */
+#ifndef NODOEMPAREJAMIENTO_HPP
+#define NODOEMPAREJAMIENTO_HPP
+
+#include <memory>
+
+/**
+ * @brief Nodo de un montículo de emparejamiento.
+ * Cada nodo es dueño de su primer hijo y de su siguiente hermano mediante `std::unique_ptr`.
+ * El puntero anterior no es dueño: apunta al padre si el nodo es el primer hijo, o al hermano anterior en otro caso.
+ * Este enlace hacia atrás permite desprender un nodo en O(1) al disminuir su clave.
+ * @tparam T Tipo de dato almacenado en el nodo.
+ */
+template <typename T>
+struct NodoEmparejamiento {
+    T dato;
+    std::unique_ptr<NodoEmparejamiento<T>> hijo;    // Primer hijo
+    std::unique_ptr<NodoEmparejamiento<T>> hermano; // Siguiente hermano
+    NodoEmparejamiento<T>* anterior;                // Padre o hermano anterior
+
+    NodoEmparejamiento(const T& valor) : dato(valor), hijo(nullptr), hermano(nullptr), anterior(nullptr) {}
+};
+
+#endif
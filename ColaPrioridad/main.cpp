@@ -0,0 +1,93 @@
+/**
+ * @file main.cpp
+ * @brief Programa principal que utiliza ColaPrioridad y MonticuloEmparejamiento.
+ * Muestra las operaciones básicas, la construcción por lotes, la disminución de clave
+ * y compara el tiempo de distintas aridades del montículo d-ario.
+ */
+#include "ColaPrioridad.hpp"
+#include "MonticuloEmparejamiento.hpp"
+#include <chrono>
+#include <random>
+#include <vector>
+
+volatile long long sumidero = 0; ///< Destino de los resultados medidos.
+
+/**
+ * @brief Mide el tiempo de construir un montículo de n elementos y vaciarlo.
+ * @tparam D Aridad del montículo a medir.
+ * @param valores Elementos a ordenar.
+ * @return Milisegundos transcurridos.
+ */
+template <std::size_t D>
+double medirAridad(const std::vector<int>& valores) {
+    auto inicio = std::chrono::steady_clock::now();
+    ColaPrioridad<int, D> cola(valores);
+    long long control = 0;
+    while (!cola.estaVacia()) {
+        control += cola.primer();
+        cola.desencolar();
+    }
+    auto fin = std::chrono::steady_clock::now();
+    sumidero = control; // Evita que el compilador descarte el trabajo
+    return std::chrono::duration<double, std::milli>(fin - inicio).count();
+}
+
+int main() {
+    // Operaciones básicas: sale primero el menor
+    ColaPrioridad<int> cola;
+    cola.encolar(30);
+    cola.encolar(10);
+    cola.encolar(20);
+    std::cout << "Frente de la cola de prioridad: " << cola.primer() << "\n";
+    cola.desencolar();
+    std::cout << "Frente después de desencolar: " << cola.primer() << "\n";
+
+    // Construcción por lotes y orden de mayor a menor con otro comparador
+    ColaPrioridad<int, 2, std::greater<int>> maximos(std::vector<int>{4, 9, 1, 7, 3});
+    std::cout << "Orden de salida con std::greater: ";
+    while (!maximos.estaVacia()) {
+        std::cout << maximos.primer() << " ";
+        maximos.desencolar();
+    }
+    std::cout << "\n";
+
+    // Montículo de emparejamiento con disminución de clave
+    MonticuloEmparejamiento<int> monticulo;
+    monticulo.encolar(50);
+    auto manejador = monticulo.encolar(80);
+    monticulo.encolar(60);
+    std::cout << "Frente del montículo: " << monticulo.primer() << "\n";
+    monticulo.disminuirClave(manejador, 5);
+    std::cout << "Frente tras disminuir 80 a 5: " << monticulo.primer() << "\n";
+    std::cout << "Orden de salida: ";
+    while (!monticulo.estaVacia()) {
+        std::cout << monticulo.primer() << " ";
+        monticulo.desencolar();
+    }
+    std::cout << "\n";
+
+    // Comparación de aridades
+    const int n = 1000000;
+    std::vector<int> valores(n);
+    std::mt19937 generador(12345);
+    for (int& v : valores) {
+        v = static_cast<int>(generador());
+    }
+    std::cout << "Tiempo para construir y vaciar " << n << " elementos:\n";
+    std::cout << "  D = 2:  " << medirAridad<2>(valores) << " ms\n";
+    std::cout << "  D = 4:  " << medirAridad<4>(valores) << " ms\n";
+    std::cout << "  D = 8:  " << medirAridad<8>(valores) << " ms\n";
+    std::cout << "  D = 16: " << medirAridad<16>(valores) << " ms\n";
+
+    auto inicio = std::chrono::steady_clock::now();
+    MonticuloEmparejamiento<int> emparejamiento;
+    emparejamiento.construir(valores);
+    while (!emparejamiento.estaVacia()) {
+        emparejamiento.desencolar();
+    }
+    auto fin = std::chrono::steady_clock::now();
+    std::cout << "  Montículo de emparejamiento: "
+              << std::chrono::duration<double, std::milli>(fin - inicio).count() << " ms\n";
+
+    return 0;
+}
@@ -0,0 +1,241 @@
+// ContadorConcurrente.h
+// Variante de Contador que se puede incrementar desde muchos hilos a la vez.
+// El valor se reparte en celdas atómicas, una por línea de caché, y cada hilo trabaja sobre la suya,
+// así los incrementos de hilos distintos no se disputan la misma línea. Nada se imprime:
+// al tocar un límite se aplica una política y se devuelve un código de resultado.
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+// Resultado de una operación sobre el contador
+enum class ResultadoContador {
+    Ok,        // Se aplicó completa
+    AlMaximo,  // Se topó con el máximo
+    AlMinimo   // Se topó con el mínimo
+};
+
+// Qué hacer cuando una operación rebasaría un límite
+enum class PoliticaSaturacion {
+    Saturar,  // Se aplica hasta el límite y el contador queda en él
+    Rechazar  // No se aplica nada
+};
+
+class ContadorConcurrente {
+public:
+    // Se llama, fuera de cualquier candado, cada vez que una operación toca un límite
+    using Aviso = std::function<void(ResultadoContador, long long delta)>;
+
+private:
+    // Sin límites, cada celda guarda su parte del valor y basta un fetch_add relajado.
+    // Con límites, cada celda guarda créditos: cuánto puede subir (mitad alta) y bajar (mitad baja)
+    // sin consultar a nadie. Incrementar pasa crédito de "subir" a "bajar" con un CAS sobre la celda.
+    struct alignas(64) Celda {
+        std::atomic<std::uint64_t> valor{0};
+    };
+
+    static constexpr std::uint64_t LIMITE_LOCAL = 1ull << 31; // Tope de cada mitad, lejos de desbordar 32 bits
+    static constexpr unsigned DESPLAZAMIENTO = 32;
+    static constexpr std::uint64_t MASCARA_BAJA = 0xFFFFFFFFull;
+
+    std::unique_ptr<Celda[]> celdas;
+    std::size_t mascaraCeldas; // Número de celdas - 1; el número de celdas es potencia de dos
+
+    bool acotado;
+    std::atomic<long long> inicial; // Base a la que se suman las celdas sin límites
+    long long minimo;
+    long long maximo;
+    PoliticaSaturacion politica;
+    Aviso aviso;
+    std::uint64_t lote; // Crédito que una celda toma de golpe del fondo común
+
+    mutable std::mutex candado;   // Protege los fondos comunes y el drenado de celdas
+    // Los fondos son sin signo: entre LLONG_MIN y LLONG_MAX caben hasta 2^64 - 1 unidades de crédito
+    std::uint64_t fondoSubir = 0; // Crédito para subir que no está en ninguna celda
+    std::uint64_t fondoBajar = 0; // Crédito para bajar que no está en ninguna celda
+
+    static std::uint64_t empacar(std::uint64_t subir, std::uint64_t bajar) {
+        return (subir << DESPLAZAMIENTO) | bajar;
+    }
+    static std::uint64_t subirDe(std::uint64_t creditos) { return creditos >> DESPLAZAMIENTO; }
+    static std::uint64_t bajarDe(std::uint64_t creditos) { return creditos & MASCARA_BAJA; }
+
+    // hasta - desde sin desbordar, con desde <= hasta
+    static std::uint64_t distancia(long long desde, long long hasta) {
+        return static_cast<std::uint64_t>(hasta) - static_cast<std::uint64_t>(desde);
+    }
+
+    // Cada hilo recibe un número al tocar por primera vez cualquier contador y siempre usa la misma celda
+    static std::size_t numeroDeHilo() {
+        static std::atomic<std::size_t> siguiente{0};
+        thread_local std::size_t numero = siguiente.fetch_add(1, std::memory_order_relaxed);
+        return numero;
+    }
+
+    Celda& celdaLocal() {
+        return celdas[numeroDeHilo() & mascaraCeldas];
+    }
+
+    static std::size_t potenciaDeDosHasta(std::size_t n) {
+        std::size_t p = 1;
+        while (p < n) {
+            p <<= 1;
+        }
+        return p;
+    }
+
+    // Devuelve a los fondos los créditos de una celda; requiere el candado
+    void drenar(Celda& celda) {
+        std::uint64_t creditos = celda.valor.exchange(0, std::memory_order_relaxed);
+        fondoSubir += subirDe(creditos);
+        fondoBajar += bajarDe(creditos);
+    }
+
+    // Camino lento con límites: la celda no tenía crédito suficiente.
+    // subir indica el sentido; delta es positivo en ambos casos.
+    ResultadoContador moverLento(Celda& celda, std::uint64_t delta, bool subir) {
+        ResultadoContador resultado = ResultadoContador::Ok;
+        std::uint64_t aplicado = delta;
+        {
+            std::lock_guard<std::mutex> guardia(candado);
+            drenar(celda);
+            std::uint64_t& origen = subir ? fondoSubir : fondoBajar;
+            std::uint64_t& destino = subir ? fondoBajar : fondoSubir;
+            if (origen < aplicado) {
+                // Otras celdas pueden guardar el crédito que falta: se reúne todo antes de decidir
+                for (std::size_t i = 0; i <= mascaraCeldas; ++i) {
+                    drenar(celdas[i]);
+                }
+            }
+            if (origen < aplicado) {
+                resultado = subir ? ResultadoContador::AlMaximo : ResultadoContador::AlMinimo;
+                aplicado = politica == PoliticaSaturacion::Saturar ? origen : 0;
+            }
+            origen -= aplicado;
+            destino += aplicado;
+            // Se deja a la celda un lote de crédito en el sentido en que se está moviendo
+            std::uint64_t cantidad = origen < lote ? origen : lote;
+            origen -= cantidad;
+            celda.valor.fetch_add(subir ? empacar(cantidad, 0) : empacar(0, cantidad), std::memory_order_relaxed);
+        }
+        if (resultado != ResultadoContador::Ok && aviso) {
+            aviso(resultado, subir ? static_cast<long long>(delta) : -static_cast<long long>(delta));
+        }
+        return resultado;
+    }
+
+    // Camino rápido con límites: un CAS sobre la celda del hilo si le alcanza el crédito
+    ResultadoContador mover(std::uint64_t delta, bool subir) {
+        Celda& celda = celdaLocal();
+        std::uint64_t creditos = celda.valor.load(std::memory_order_relaxed);
+        while (delta < LIMITE_LOCAL) {
+            std::uint64_t arriba = subirDe(creditos);
+            std::uint64_t abajo = bajarDe(creditos);
+            std::uint64_t& gasta = subir ? arriba : abajo;
+            std::uint64_t& gana = subir ? abajo : arriba;
+            if (gasta < delta || gana + delta >= LIMITE_LOCAL) {
+                break;
+            }
+            gasta -= delta;
+            gana += delta;
+            if (celda.valor.compare_exchange_weak(creditos, empacar(arriba, abajo), std::memory_order_relaxed)) {
+                return ResultadoContador::Ok;
+            }
+        }
+        return moverLento(celda, delta, subir);
+    }
+
+public:
+    // Contador sin límites: incrementar y decrementar son un fetch_add relajado
+    explicit ContadorConcurrente(long long valorInicial = 0, std::size_t numCeldas = std::thread::hardware_concurrency())
+        : celdas(new Celda[potenciaDeDosHasta(numCeldas ? numCeldas : 1)]),
+          mascaraCeldas(potenciaDeDosHasta(numCeldas ? numCeldas : 1) - 1),
+          acotado(false), inicial(valorInicial),
+          minimo(std::numeric_limits<long long>::min()), maximo(std::numeric_limits<long long>::max()),
+          politica(PoliticaSaturacion::Saturar), lote(0) {}
+
+    // Contador acotado a [minimoPermitido, maximoPermitido], como Contador con su máximo y su mínimo 0
+    ContadorConcurrente(long long valorInicial, long long minimoPermitido, long long maximoPermitido,
+                        PoliticaSaturacion politicaSaturacion = PoliticaSaturacion::Saturar, Aviso alTocarLimite = nullptr,
+                        std::size_t numCeldas = std::thread::hardware_concurrency(), std::uint64_t creditoPorLote = 1024)
+        : celdas(new Celda[potenciaDeDosHasta(numCeldas ? numCeldas : 1)]),
+          mascaraCeldas(potenciaDeDosHasta(numCeldas ? numCeldas : 1) - 1),
+          acotado(true), inicial(valorInicial), minimo(minimoPermitido), maximo(maximoPermitido),
+          politica(politicaSaturacion), aviso(std::move(alTocarLimite)),
+          lote(creditoPorLote < LIMITE_LOCAL / 2 ? creditoPorLote : LIMITE_LOCAL / 2) {
+        if (minimo > maximo || valorInicial < minimo || valorInicial > maximo) {
+            throw std::invalid_argument("Se requiere minimo <= valorInicial <= maximo.");
+        }
+        fondoBajar = distancia(minimo, valorInicial);
+        fondoSubir = distancia(valorInicial, maximo);
+    }
+
+    ContadorConcurrente(const ContadorConcurrente&) = delete;
+    ContadorConcurrente& operator=(const ContadorConcurrente&) = delete;
+
+    // Suma delta al contador
+    ResultadoContador incrementar(std::uint64_t delta = 1) {
+        if (!acotado) {
+            celdaLocal().valor.fetch_add(delta, std::memory_order_relaxed);
+            return ResultadoContador::Ok;
+        }
+        return mover(delta, true);
+    }
+
+    // Resta delta al contador
+    ResultadoContador decrementar(std::uint64_t delta = 1) {
+        if (!acotado) {
+            celdaLocal().valor.fetch_sub(delta, std::memory_order_relaxed);
+            return ResultadoContador::Ok;
+        }
+        return mover(delta, false);
+    }
+
+    // Suma de todas las celdas. Con incrementos en curso es una foto de algún momento reciente;
+    // con límites siempre está dentro de [minimo, maximo].
+    long long obtenerValor() const {
+        if (!acotado) {
+            std::uint64_t suma = 0;
+            for (std::size_t i = 0; i <= mascaraCeldas; ++i) {
+                suma += celdas[i].valor.load(std::memory_order_relaxed);
+            }
+            return inicial.load(std::memory_order_relaxed) + static_cast<long long>(suma); // La suma sin signo da el mismo resultado en complemento a dos
+        }
+        std::lock_guard<std::mutex> guardia(candado);
+        std::uint64_t bajar = fondoBajar;
+        for (std::size_t i = 0; i <= mascaraCeldas; ++i) {
+            bajar += bajarDe(celdas[i].valor.load(std::memory_order_relaxed));
+        }
+        return static_cast<long long>(static_cast<std::uint64_t>(minimo) + bajar); // Igual que arriba: sin signo, sin desbordar
+    }
+
+    // Deja el contador en valor; los incrementos simultáneos pueden contarse antes o después del reinicio
+    void reiniciar(long long valor = 0) {
+        if (valor < minimo || valor > maximo) {
+            throw std::invalid_argument("El valor de reinicio está fuera de los límites.");
+        }
+        if (!acotado) {
+            for (std::size_t i = 0; i <= mascaraCeldas; ++i) {
+                celdas[i].valor.store(0, std::memory_order_relaxed);
+            }
+            inicial.store(valor, std::memory_order_relaxed);
+            return;
+        }
+        std::lock_guard<std::mutex> guardia(candado);
+        for (std::size_t i = 0; i <= mascaraCeldas; ++i) {
+            celdas[i].valor.store(0, std::memory_order_relaxed);
+        }
+        fondoBajar = distancia(minimo, valor);
+        fondoSubir = distancia(valor, maximo);
+    }
+
+    long long obtenerMinimo() const { return minimo; }
+    long long obtenerMaximo() const { return maximo; }
+    std::size_t numeroDeCeldas() const { return mascaraCeldas + 1; }
+};
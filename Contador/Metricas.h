@@ -0,0 +1,307 @@
+// Metricas.h
+// Registro de métricas con nombre: contadores (ContadorConcurrente), indicadores que suben y bajan,
+// e histogramas de latencia con cubetas logarítmicas al estilo HDR. Registrar un valor no toma candados;
+// el candado del registro sólo se usa al dar de alta una métrica y al exportar.
+// La exportación sigue el formato de texto de Prometheus y se puede obtener como cadena o escribir a un archivo.
+#pragma once
+#include "ContadorConcurrente.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Valor que puede subir y bajar, como la ocupación de una cola o el tamaño de una caché
+class Indicador {
+private:
+    std::atomic<double> valor{0.0};
+
+public:
+    void establecer(double nuevo) {
+        valor.store(nuevo, std::memory_order_relaxed);
+    }
+
+    // std::atomic<double> no tiene fetch_add antes de C++20, así que se suma con un CAS
+    void sumar(double delta) {
+        double actual = valor.load(std::memory_order_relaxed);
+        while (!valor.compare_exchange_weak(actual, actual + delta, std::memory_order_relaxed)) {
+        }
+    }
+
+    void restar(double delta) {
+        sumar(-delta);
+    }
+
+    double obtenerValor() const {
+        return valor.load(std::memory_order_relaxed);
+    }
+};
+
+// Copia de los conteos de un histograma en un momento dado
+struct InstantaneaHistograma {
+    std::vector<std::uint64_t> cubetas;
+    std::uint64_t cuenta = 0;
+    std::uint64_t suma = 0;
+
+    double promedio() const {
+        return cuenta ? static_cast<double>(suma) / static_cast<double>(cuenta) : 0.0;
+    }
+
+    // Cota superior de la cubeta donde cae el cuantil q (entre 0 y 1); el error relativo es a lo más 1/16
+    std::uint64_t percentil(double q) const;
+};
+
+// Histograma de enteros no negativos (por ejemplo, nanosegundos) con cubetas log-lineales:
+// cada potencia de dos se divide en 16 cubetas iguales, así el error relativo es a lo más 6.25%
+// en todo el rango de 64 bits con menos de mil cubetas. Las cubetas cubren (2^k, 2^(k+1)] para que
+// sus bordes coincidan con potencias de dos exactas al exportar.
+class Histograma {
+public:
+    static constexpr unsigned BITS_SUBCUBETA = 4;
+    static constexpr std::size_t SUBCUBETAS = std::size_t(1) << BITS_SUBCUBETA;
+    static constexpr std::size_t NUM_CUBETAS = 1 + (65 - BITS_SUBCUBETA) * SUBCUBETAS;
+
+private:
+    std::array<std::atomic<std::uint64_t>, NUM_CUBETAS> cubetas{};
+    std::atomic<std::uint64_t> suma{0};
+
+    static unsigned bitMasAlto(std::uint64_t x) {
+        unsigned posicion = 0;
+        while (x >>= 1) {
+            ++posicion;
+        }
+        return posicion;
+    }
+
+public:
+    // Cubeta de un valor: 0 guarda al cero; los demás se indexan por x = valor - 1
+    static std::size_t indiceDe(std::uint64_t valor) {
+        if (valor == 0) {
+            return 0;
+        }
+        std::uint64_t x = valor - 1;
+        if (x < SUBCUBETAS) {
+            return 1 + static_cast<std::size_t>(x);
+        }
+        unsigned exponente = bitMasAlto(x);
+        std::size_t sub = static_cast<std::size_t>(x >> (exponente - BITS_SUBCUBETA)) & (SUBCUBETAS - 1);
+        return 1 + (exponente - BITS_SUBCUBETA + 1) * SUBCUBETAS + sub;
+    }
+
+    // Mayor valor que cae en la cubeta indice
+    static std::uint64_t cotaSuperior(std::size_t indice) {
+        if (indice == 0) {
+            return 0;
+        }
+        std::size_t j = indice - 1;
+        if (j < SUBCUBETAS) {
+            return j + 1;
+        }
+        unsigned ancho = static_cast<unsigned>(j / SUBCUBETAS - 1); // Bits que cada subcubeta deja sin distinguir
+        std::uint64_t inicio = static_cast<std::uint64_t>(SUBCUBETAS + j % SUBCUBETAS) << ancho;
+        std::uint64_t maximoX = inicio + ((std::uint64_t(1) << ancho) - 1);
+        return maximoX == UINT64_MAX ? UINT64_MAX : maximoX + 1; // La última cubeta termina en el máximo de 64 bits
+    }
+
+    // Registra un valor con dos sumas atómicas relajadas
+    void registrar(std::uint64_t valor) {
+        cubetas[indiceDe(valor)].fetch_add(1, std::memory_order_relaxed);
+        suma.fetch_add(valor, std::memory_order_relaxed);
+    }
+
+    InstantaneaHistograma instantanea() const {
+        InstantaneaHistograma foto;
+        foto.cubetas.resize(NUM_CUBETAS);
+        for (std::size_t i = 0; i < NUM_CUBETAS; ++i) {
+            foto.cubetas[i] = cubetas[i].load(std::memory_order_relaxed);
+            foto.cuenta += foto.cubetas[i];
+        }
+        foto.suma = suma.load(std::memory_order_relaxed);
+        return foto;
+    }
+
+    void reiniciar() {
+        for (std::atomic<std::uint64_t>& cubeta : cubetas) {
+            cubeta.store(0, std::memory_order_relaxed);
+        }
+        suma.store(0, std::memory_order_relaxed);
+    }
+};
+
+inline std::uint64_t InstantaneaHistograma::percentil(double q) const {
+    if (cuenta == 0) {
+        return 0;
+    }
+    q = std::min(std::max(q, 0.0), 1.0);
+    std::uint64_t rango = static_cast<std::uint64_t>(q * static_cast<double>(cuenta - 1)) + 1;
+    std::uint64_t acumulado = 0;
+    for (std::size_t i = 0; i < cubetas.size(); ++i) {
+        acumulado += cubetas[i];
+        if (acumulado >= rango) {
+            return Histograma::cotaSuperior(i);
+        }
+    }
+    return Histograma::cotaSuperior(cubetas.size() - 1);
+}
+
+class RegistroMetricas {
+private:
+    enum class Tipo { Contador, Indicador, Histograma };
+
+    struct Entrada {
+        Tipo tipo;
+        std::string ayuda;
+        std::unique_ptr<ContadorConcurrente> contador;
+        std::unique_ptr<Indicador> indicador;
+        std::unique_ptr<Histograma> histograma;
+    };
+
+    mutable std::mutex candado;
+    std::map<std::string, Entrada> metricas; // Ordenadas por nombre para que la exportación sea estable
+
+    // Nombres válidos en Prometheus: [a-zA-Z_:][a-zA-Z0-9_:]*
+    static void validarNombre(const std::string& nombre) {
+        auto letra = [](char c) { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || c == ':'; };
+        bool valido = !nombre.empty() && letra(nombre[0]);
+        for (char c : nombre) {
+            valido = valido && (letra(c) || (c >= '0' && c <= '9'));
+        }
+        if (!valido) {
+            throw std::invalid_argument("Nombre de métrica inválido: " + nombre);
+        }
+    }
+
+    // Busca o da de alta la métrica; un mismo nombre no puede usarse con dos tipos
+    Entrada& obtenerEntrada(const std::string& nombre, const std::string& ayuda, Tipo tipo) {
+        auto it = metricas.find(nombre);
+        if (it != metricas.end()) {
+            if (it->second.tipo != tipo) {
+                throw std::invalid_argument("La métrica " + nombre + " ya existe con otro tipo.");
+            }
+            return it->second;
+        }
+        validarNombre(nombre);
+        Entrada& entrada = metricas[nombre];
+        entrada.tipo = tipo;
+        entrada.ayuda = ayuda;
+        return entrada;
+    }
+
+    static void escribirEncabezado(std::ostringstream& salida, const std::string& nombre, const Entrada& entrada, const char* tipo) {
+        if (!entrada.ayuda.empty()) {
+            salida << "# HELP " << nombre << ' ';
+            for (char c : entrada.ayuda) {
+                if (c == '\\') {
+                    salida << "\\\\";
+                } else if (c == '\n') {
+                    salida << "\\n";
+                } else {
+                    salida << c;
+                }
+            }
+            salida << '\n';
+        }
+        salida << "# TYPE " << nombre << ' ' << tipo << '\n';
+    }
+
+    static void escribirHistograma(std::ostringstream& salida, const std::string& nombre, const InstantaneaHistograma& foto) {
+        // Cubetas acumuladas en potencias de dos, hasta la primera que incluye al valor más grande registrado
+        std::size_t ultimaOcupada = 0;
+        for (std::size_t i = 0; i < foto.cubetas.size(); ++i) {
+            if (foto.cubetas[i]) {
+                ultimaOcupada = i;
+            }
+        }
+        std::uint64_t acumulado = 0;
+        std::size_t i = 0;
+        for (unsigned k = 0; k < 64; ++k) {
+            std::uint64_t limite = std::uint64_t(1) << k;
+            while (i < foto.cubetas.size() && Histograma::cotaSuperior(i) <= limite) {
+                acumulado += foto.cubetas[i++];
+            }
+            salida << nombre << "_bucket{le=\"" << limite << "\"} " << acumulado << '\n';
+            if (i > ultimaOcupada) {
+                break;
+            }
+        }
+        salida << nombre << "_bucket{le=\"+Inf\"} " << foto.cuenta << '\n';
+        salida << nombre << "_sum " << foto.suma << '\n';
+        salida << nombre << "_count " << foto.cuenta << '\n';
+    }
+
+public:
+    // Las referencias devueltas siguen siendo válidas mientras viva el registro;
+    // conviene guardarlas en lugar de buscar por nombre en cada operación.
+    ContadorConcurrente& contador(const std::string& nombre, const std::string& ayuda = "") {
+        std::lock_guard<std::mutex> guardia(candado);
+        Entrada& entrada = obtenerEntrada(nombre, ayuda, Tipo::Contador);
+        if (!entrada.contador) {
+            entrada.contador = std::make_unique<ContadorConcurrente>();
+        }
+        return *entrada.contador;
+    }
+
+    Indicador& indicador(const std::string& nombre, const std::string& ayuda = "") {
+        std::lock_guard<std::mutex> guardia(candado);
+        Entrada& entrada = obtenerEntrada(nombre, ayuda, Tipo::Indicador);
+        if (!entrada.indicador) {
+            entrada.indicador = std::make_unique<Indicador>();
+        }
+        return *entrada.indicador;
+    }
+
+    Histograma& histograma(const std::string& nombre, const std::string& ayuda = "") {
+        std::lock_guard<std::mutex> guardia(candado);
+        Entrada& entrada = obtenerEntrada(nombre, ayuda, Tipo::Histograma);
+        if (!entrada.histograma) {
+            entrada.histograma = std::make_unique<Histograma>();
+        }
+        return *entrada.histograma;
+    }
+
+    std::size_t tamano() const {
+        std::lock_guard<std::mutex> guardia(candado);
+        return metricas.size();
+    }
+
+    // Todas las métricas en el formato de texto de Prometheus
+    std::string exportarPrometheus() const {
+        std::lock_guard<std::mutex> guardia(candado);
+        std::ostringstream salida;
+        salida.precision(15);
+        for (const auto& par : metricas) {
+            const std::string& nombre = par.first;
+            const Entrada& entrada = par.second;
+            switch (entrada.tipo) {
+                case Tipo::Contador:
+                    escribirEncabezado(salida, nombre, entrada, "counter");
+                    salida << nombre << ' ' << entrada.contador->obtenerValor() << '\n';
+                    break;
+                case Tipo::Indicador:
+                    escribirEncabezado(salida, nombre, entrada, "gauge");
+                    salida << nombre << ' ' << entrada.indicador->obtenerValor() << '\n';
+                    break;
+                case Tipo::Histograma:
+                    escribirEncabezado(salida, nombre, entrada, "histogram");
+                    escribirHistograma(salida, nombre, entrada.histograma->instantanea());
+                    break;
+            }
+        }
+        return salida.str();
+    }
+
+    // Escribe la exportación en un archivo; devuelve false si no se pudo escribir
+    bool escribirPrometheus(const std::string& ruta) const {
+        std::ofstream archivo(ruta);
+        archivo << exportarPrometheus();
+        return static_cast<bool>(archivo);
+    }
+};
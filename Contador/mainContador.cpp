@@ -1,5 +1,9 @@
 #include <iostream>
 #include "TDAContador.h"
+#include "ContadorConcurrente.h"
+#include "Metricas.h"
+#include <thread>
+#include <vector>
 
 int main() {
     Contador c1(5); // Inicia en 5
@@ -16,5 +20,42 @@ int main() {
     c1.reiniciar();
     std::cout << "Después de reiniciar: " << c1.obtenerValor() << "\n";
 
+    // Varios hilos incrementan el mismo contador; cada uno escribe en su propia celda
+    ContadorConcurrente peticiones;
+    std::vector<std::thread> hilos;
+    for (int h = 0; h < 4; ++h) {
+        hilos.emplace_back([&peticiones] {
+            for (int i = 0; i < 100000; ++i) {
+                peticiones.incrementar();
+            }
+        });
+    }
+    for (std::thread& hilo : hilos) {
+        hilo.join();
+    }
+    std::cout << "Peticiones contadas por 4 hilos: " << peticiones.obtenerValor() << "\n";
+
+    // Acotado como Contador, pero sin imprimir: el límite se informa con el resultado
+    ContadorConcurrente acotado(998, 0, 1000, PoliticaSaturacion::Saturar);
+    acotado.incrementar();
+    acotado.incrementar();
+    if (acotado.incrementar() == ResultadoContador::AlMaximo) {
+        std::cout << "El contador acotado se quedó en su máximo: " << acotado.obtenerValor() << "\n";
+    }
+
+    // Registro de métricas exportado en formato Prometheus
+    RegistroMetricas registro;
+    ContadorConcurrente& operaciones = registro.contador("operaciones_total", "Operaciones atendidas.");
+    Indicador& enCola = registro.indicador("cola_pendientes", "Elementos esperando en la cola.");
+    Histograma& latencia = registro.histograma("latencia_ns", "Latencia de cada operación en nanosegundos.");
+    for (int i = 1; i <= 100; ++i) {
+        operaciones.incrementar();
+        latencia.registrar(static_cast<std::uint64_t>(i) * 100);
+    }
+    enCola.establecer(7);
+    InstantaneaHistograma foto = latencia.instantanea();
+    std::cout << "Latencia p50: " << foto.percentil(0.5) << " ns, p99: " << foto.percentil(0.99) << " ns\n";
+    std::cout << registro.exportarPrometheus();
+
     return 0;
 }
\ No newline at end of file
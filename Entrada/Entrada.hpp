@@ -0,0 +1,356 @@
+/**
+ * @file Entrada.hpp
+ * @brief Capa de entrada para cargar arreglos de enteros desde archivos grandes sin pedirlos uno por uno.
+ * El archivo se mapea en memoria (o, donde no hay mmap, se lee de un solo golpe) y se entrega como un Tramo,
+ * una vista que no copia los datos. Los archivos binarios de int32 o int64 se usan tal cual desde el mapeo;
+ * los de texto se analizan con un lector de enteros que convierte 8 dígitos a la vez cuando puede.
+ * También se puede leer texto desde un flujo, como la entrada estándar, por bloques de 1 MiB.
+ */
+#ifndef ENTRADA_HPP
+#define ENTRADA_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define ENTRADA_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Vista de solo lectura sobre n elementos contiguos; no es dueña de la memoria.
+ */
+template <typename T>
+class Tramo {
+private:
+    const T* inicio;
+    std::size_t n;
+
+public:
+    Tramo(const T* datos = nullptr, std::size_t tamano = 0) : inicio(datos), n(tamano) {}
+
+    const T* datos() const { return inicio; }
+    std::size_t tamano() const { return n; }
+    bool estaVacio() const { return n == 0; }
+    const T& operator[](std::size_t i) const { return inicio[i]; }
+    const T* begin() const { return inicio; }
+    const T* end() const { return inicio + n; }
+
+    /**
+     * @brief Subvista de cantidad elementos a partir de desde, sin copiar.
+     */
+    Tramo subtramo(std::size_t desde, std::size_t cantidad) const {
+        return Tramo(inicio + desde, cantidad);
+    }
+};
+
+/**
+ * @brief Formato del archivo de enteros.
+ */
+enum class FormatoEntrada {
+    Texto,        ///< Enteros en decimal separados por espacios, saltos de línea, comas o punto y coma.
+    BinarioInt32, ///< int32 en el orden de bytes de la máquina, uno tras otro.
+    BinarioInt64  ///< int64 en el orden de bytes de la máquina, uno tras otro.
+};
+
+/**
+ * @class ArchivoMapeado
+ * @brief Contenido completo de un archivo en memoria, de solo lectura.
+ * Con mmap el sistema carga las páginas a medida que se leen y no hay copia a un búfer propio.
+ */
+class ArchivoMapeado {
+private:
+    const char* contenido = nullptr;
+    std::size_t bytes = 0;
+    bool mapeado = false;        ///< true si contenido viene de mmap y hay que liberarlo con munmap.
+    std::vector<char> respaldo;  ///< Copia del archivo cuando no se pudo mapear.
+
+    void liberar() {
+#ifdef ENTRADA_MMAP
+        if (mapeado) {
+            munmap(const_cast<char*>(contenido), bytes);
+        }
+#endif
+        contenido = nullptr;
+        bytes = 0;
+        mapeado = false;
+        respaldo.clear();
+    }
+
+    void leerCompleto(const std::string& ruta) {
+        std::ifstream archivo(ruta, std::ios::binary | std::ios::ate);
+        if (!archivo) {
+            throw std::runtime_error("No se pudo abrir el archivo " + ruta + ".");
+        }
+        respaldo.resize(static_cast<std::size_t>(archivo.tellg()));
+        archivo.seekg(0);
+        archivo.read(respaldo.data(), static_cast<std::streamsize>(respaldo.size()));
+        contenido = respaldo.data();
+        bytes = respaldo.size();
+    }
+
+public:
+    ArchivoMapeado() = default;
+
+    /**
+     * @brief Mapea el archivo completo.
+     * @throws std::runtime_error Si el archivo no se puede abrir.
+     */
+    explicit ArchivoMapeado(const std::string& ruta) {
+#ifdef ENTRADA_MMAP
+        int descriptor = open(ruta.c_str(), O_RDONLY);
+        if (descriptor < 0) {
+            throw std::runtime_error("No se pudo abrir el archivo " + ruta + ".");
+        }
+        struct stat info;
+        if (fstat(descriptor, &info) == 0 && info.st_size > 0) {
+            void* mapa = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+            if (mapa != MAP_FAILED) {
+                // Se leerá de principio a fin: se le pide al sistema que adelante la lectura
+                madvise(mapa, static_cast<std::size_t>(info.st_size), MADV_SEQUENTIAL);
+                contenido = static_cast<const char*>(mapa);
+                bytes = static_cast<std::size_t>(info.st_size);
+                mapeado = true;
+            }
+        }
+        close(descriptor);
+        if (mapeado) {
+            return;
+        }
+#endif
+        // Sin mmap, o si el mapeo falló (por ejemplo, un archivo vacío o especial), se lee de un solo golpe
+        leerCompleto(ruta);
+    }
+
+    ~ArchivoMapeado() {
+        liberar();
+    }
+
+    ArchivoMapeado(const ArchivoMapeado&) = delete;
+    ArchivoMapeado& operator=(const ArchivoMapeado&) = delete;
+
+    ArchivoMapeado(ArchivoMapeado&& otro) noexcept {
+        *this = std::move(otro);
+    }
+
+    ArchivoMapeado& operator=(ArchivoMapeado&& otro) noexcept {
+        if (this != &otro) {
+            liberar();
+            mapeado = otro.mapeado;
+            bytes = otro.bytes;
+            respaldo = std::move(otro.respaldo);
+            contenido = mapeado ? otro.contenido : respaldo.data();
+            otro.contenido = nullptr;
+            otro.bytes = 0;
+            otro.mapeado = false;
+        }
+        return *this;
+    }
+
+    const char* datos() const { return contenido; }
+    std::size_t tamano() const { return bytes; }
+};
+
+/**
+ * @brief Interpreta 8 caracteres como dígitos y devuelve su valor, o -1 si alguno no es dígito.
+ * Convierte los 8 a la vez dentro de un entero de 64 bits (SWAR): primero pares de dígitos, luego grupos de 4 y al final los 8.
+ */
+inline long long ochoDigitos(const char* texto) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    std::uint64_t v;
+    std::memcpy(&v, texto, sizeof(v));
+    // Un byte es dígito si su mitad alta es 3 y sumarle 6 no la cambia (es decir, está entre '0' y '9')
+    if ((((v & 0xF0F0F0F0F0F0F0F0ull) | (((v + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4))) != 0x3333333333333333ull) {
+        return -1;
+    }
+    v = (v & 0x0F0F0F0F0F0F0F0Full) * 2561 >> 8;
+    v = (v & 0x00FF00FF00FF00FFull) * 6553601 >> 16;
+    v = (v & 0x0000FFFF0000FFFFull) * 42949672960001ull >> 32;
+    return static_cast<long long>(v);
+#else
+    long long valor = 0;
+    for (int i = 0; i < 8; ++i) {
+        if (texto[i] < '0' || texto[i] > '9') {
+            return -1;
+        }
+        valor = valor * 10 + (texto[i] - '0');
+    }
+    return valor;
+#endif
+}
+
+/**
+ * @brief Analiza los enteros en decimal de [inicio, fin) y los agrega a salida.
+ * @param inicio Primer carácter.
+ * @param fin Uno después del último; si el texto termina a la mitad de un número, ese número se toma completo.
+ * @param desplazamiento Posición de inicio dentro del archivo, sólo para los mensajes de error.
+ * @throws std::runtime_error Si hay un carácter que no es dígito, signo ni separador, o un número no cabe en T.
+ */
+template <typename T>
+void analizarEnteros(const char* inicio, const char* fin, std::vector<T>& salida, std::size_t desplazamiento = 0) {
+    static_assert(std::is_integral<T>::value && std::is_signed<T>::value, "analizarEnteros requiere un entero con signo.");
+    const char* p = inicio;
+    while (p < fin) {
+        char c = *p;
+        if (c == ' ' || c == '\n' || c == '\r' || c == '\t' || c == ',' || c == ';') {
+            ++p;
+            continue;
+        }
+        bool negativo = false;
+        if (c == '-' || c == '+') {
+            negativo = c == '-';
+            ++p;
+        }
+        const char* numero = p;
+        // Los ceros a la izquierda no cuentan para el límite de 19 dígitos
+        while (p < fin && *p == '0') {
+            ++p;
+        }
+        const char* digitos = p;
+        std::uint64_t valor = 0;
+        // Bloques de 8 dígitos mientras quepan en el texto; un int64 tiene a lo más 19 dígitos
+        while (fin - p >= 8 && p - digitos < 16) {
+            long long bloque = ochoDigitos(p);
+            if (bloque < 0) {
+                break;
+            }
+            valor = valor * 100000000ull + static_cast<std::uint64_t>(bloque);
+            p += 8;
+        }
+        while (p < fin && *p >= '0' && *p <= '9' && p - digitos < 20) {
+            valor = valor * 10 + static_cast<std::uint64_t>(*p - '0');
+            ++p;
+        }
+        std::size_t posicion = desplazamiento + static_cast<std::size_t>(numero - inicio);
+        if (p == numero) {
+            throw std::runtime_error("Carácter inesperado en la posición " + std::to_string(posicion) + ".");
+        }
+        const std::uint64_t limite = static_cast<std::uint64_t>(std::numeric_limits<T>::max()) + (negativo ? 1 : 0);
+        if (p - digitos > 19 || valor > limite || (p < fin && *p >= '0' && *p <= '9')) {
+            throw std::runtime_error("Número fuera de rango en la posición " + std::to_string(posicion) + ".");
+        }
+        // Se niega en sin signo para que el mínimo de T no desborde
+        salida.push_back(static_cast<T>(negativo ? 0 - valor : valor));
+    }
+}
+
+/**
+ * @class DatosEnteros
+ * @brief Arreglo de enteros cargado de un archivo, expuesto como un Tramo.
+ * En binario el Tramo apunta directo al archivo mapeado; en texto, al arreglo con los números analizados.
+ * @tparam T int32_t o int64_t (o int, long long).
+ */
+template <typename T>
+class DatosEnteros {
+private:
+    ArchivoMapeado archivo;
+    std::vector<T> analizados;
+    Tramo<T> vista;
+
+public:
+    DatosEnteros() = default;
+
+    /**
+     * @brief Carga un archivo.
+     * @throws std::runtime_error Si no se puede abrir, si el tamaño no es múltiplo del elemento en binario,
+     * si el formato binario no coincide con T, o si el texto no es válido.
+     */
+    DatosEnteros(const std::string& ruta, FormatoEntrada formato) : archivo(ruta) {
+        if (formato == FormatoEntrada::Texto) {
+            // Un número ocupa al menos dos caracteres con su separador: se reserva para el peor caso habitual
+            analizados.reserve(archivo.tamano() / 2 + 1);
+            analizarEnteros(archivo.datos(), archivo.datos() + archivo.tamano(), analizados);
+            analizados.shrink_to_fit();
+            vista = Tramo<T>(analizados.data(), analizados.size());
+            return;
+        }
+        std::size_t ancho = formato == FormatoEntrada::BinarioInt32 ? 4 : 8;
+        if (ancho != sizeof(T)) {
+            throw std::runtime_error("El formato binario no coincide con el tipo del arreglo.");
+        }
+        if (archivo.tamano() % sizeof(T) != 0) {
+            throw std::runtime_error("El tamaño del archivo no es múltiplo del tamaño de cada entero.");
+        }
+        // mmap devuelve memoria alineada a página, así que se puede leer como T sin copiar
+        vista = Tramo<T>(reinterpret_cast<const T*>(archivo.datos()), archivo.tamano() / sizeof(T));
+    }
+
+    DatosEnteros(const DatosEnteros&) = delete;
+    DatosEnteros& operator=(const DatosEnteros&) = delete;
+
+    /**
+     * @brief Enteros de texto ya analizados, por ejemplo desde un flujo.
+     */
+    explicit DatosEnteros(std::vector<T> valores) : analizados(std::move(valores)), vista(analizados.data(), analizados.size()) {}
+
+    const Tramo<T>& tramo() const { return vista; }
+    std::size_t tamano() const { return vista.tamano(); }
+    const T* datos() const { return vista.datos(); }
+};
+
+/**
+ * @brief Lee enteros en texto desde un flujo (por ejemplo stdin) por bloques de 1 MiB.
+ * Un número partido entre dos bloques se guarda y se completa con el bloque siguiente. Como los ceros a la izquierda
+ * no tienen límite, el número pendiente puede ser de cualquier largo: el búfer crece para que siempre quepa
+ * un bloque entero detrás de él.
+ * @throws std::runtime_error Si el texto no es válido.
+ */
+template <typename T>
+DatosEnteros<T> leerEnterosDeFlujo(std::FILE* flujo) {
+    const std::size_t BLOQUE = std::size_t(1) << 20;
+    std::vector<char> bufer(BLOQUE);
+    std::vector<T> valores;
+    std::size_t pendientes = 0;  // Caracteres de un número incompleto al final del bloque anterior
+    std::size_t leidosAntes = 0; // Posición en el flujo del inicio del búfer
+    while (true) {
+        if (bufer.size() < pendientes + BLOQUE) {
+            bufer.resize(pendientes + BLOQUE);
+        }
+        std::size_t leidos = std::fread(bufer.data() + pendientes, 1, BLOQUE, flujo);
+        std::size_t total = pendientes + leidos;
+        if (leidos == 0) {
+            analizarEnteros(bufer.data(), bufer.data() + total, valores, leidosAntes);
+            break;
+        }
+        // Sólo se analiza hasta el último separador; lo que sigue puede ser un número incompleto
+        std::size_t corte = total;
+        while (corte > 0) {
+            char c = bufer[corte - 1];
+            if (c == ' ' || c == '\n' || c == '\r' || c == '\t' || c == ',' || c == ';') {
+                break;
+            }
+            --corte;
+        }
+        analizarEnteros(bufer.data(), bufer.data() + corte, valores, leidosAntes);
+        pendientes = total - corte;
+        std::memmove(bufer.data(), bufer.data() + corte, pendientes);
+        leidosAntes += corte;
+    }
+    return DatosEnteros<T>(std::move(valores));
+}
+
+/**
+ * @brief Interpreta las opciones de línea de comandos de las herramientas de arreglos.
+ * @param opcion "--int32", "--int64" o "--texto".
+ * @throws std::invalid_argument Si la opción no es ninguna de ellas.
+ */
+inline FormatoEntrada formatoDesdeOpcion(const std::string& opcion) {
+    if (opcion == "--int32") return FormatoEntrada::BinarioInt32;
+    if (opcion == "--int64") return FormatoEntrada::BinarioInt64;
+    if (opcion == "--texto") return FormatoEntrada::Texto;
+    throw std::invalid_argument("Formato desconocido: " + opcion + " (use --texto, --int32 o --int64).");
+}
+
+#endif
@@ -0,0 +1,121 @@
+/**
+ * @file main.cpp
+ * @brief Programa de ejemplo de la capa de entrada.
+ * Escribe un archivo de texto y uno binario con los mismos enteros, los carga con DatosEnteros
+ * y compara el tiempo de cada formato con la lectura clásica usando std::cin >>.
+ */
+#include "Entrada.hpp"
+#include "../Reduccion/Reduccion.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+
+namespace {
+double milisegundosDesde(std::chrono::steady_clock::time_point inicio) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - inicio).count();
+}
+}
+
+int main() {
+    const std::size_t N = 2000000;
+    const std::string rutaTexto = "entrada_ejemplo.txt";
+    const std::string rutaBinaria = "entrada_ejemplo.bin";
+
+    std::mt19937 generador(42);
+    std::uniform_int_distribution<int32_t> distribucion(-1000000000, 1000000000);
+    std::vector<int32_t> valores(N);
+    for (int32_t& v : valores) {
+        v = distribucion(generador);
+    }
+    {
+        std::ofstream texto(rutaTexto);
+        for (int32_t v : valores) {
+            texto << v << '\n';
+        }
+        std::ofstream binario(rutaBinaria, std::ios::binary);
+        binario.write(reinterpret_cast<const char*>(valores.data()), static_cast<std::streamsize>(N * sizeof(int32_t)));
+    }
+
+    auto inicio = std::chrono::steady_clock::now();
+    DatosEnteros<int32_t> desdeTexto(rutaTexto, FormatoEntrada::Texto);
+    double msTexto = milisegundosDesde(inicio);
+
+    inicio = std::chrono::steady_clock::now();
+    DatosEnteros<int32_t> desdeBinario(rutaBinaria, FormatoEntrada::BinarioInt32);
+    double msBinario = milisegundosDesde(inicio);
+
+    inicio = std::chrono::steady_clock::now();
+    std::ifstream clasico(rutaTexto);
+    std::vector<int32_t> conFlujo;
+    int32_t v;
+    while (clasico >> v) {
+        conFlujo.push_back(v);
+    }
+    double msFlujo = milisegundosDesde(inicio);
+
+    std::cout << "Texto con DatosEnteros:  " << desdeTexto.tamano() << " enteros en " << msTexto << " ms\n";
+    std::cout << "Binario mapeado:         " << desdeBinario.tamano() << " enteros en " << msBinario << " ms\n";
+    std::cout << "Texto con operator>>:    " << conFlujo.size() << " enteros en " << msFlujo << " ms\n";
+    std::cout << "Sumas: " << sumar(desdeTexto.datos(), desdeTexto.tamano()) << " "
+              << sumar(desdeBinario.datos(), desdeBinario.tamano()) << " "
+              << sumar(conFlujo.data(), conFlujo.size()) << "\n";
+    std::remove(rutaTexto.c_str());
+    std::remove(rutaBinaria.c_str());
+
+    // Lectura por bloques: números con muchos ceros a la izquierda quedan partidos entre bloques de 1 MiB.
+    // El resultado debe coincidir exactamente con lo escrito; si no, el programa termina con error.
+    {
+        const std::size_t BLOQUE = std::size_t(1) << 20;
+        std::string texto;
+        std::vector<int32_t> esperados;
+        std::uniform_int_distribution<int> ceros(0, 80);
+        auto escribir = [&](int32_t valor, std::size_t cerosIzquierda) {
+            esperados.push_back(valor);
+            if (valor < 0) texto += '-';
+            texto.append(cerosIzquierda, '0');
+            texto += std::to_string(valor < 0 ? -static_cast<int64_t>(valor) : valor);
+            texto += ' ';
+        };
+        while (texto.size() < BLOQUE - 200) {
+            escribir(distribucion(generador), static_cast<std::size_t>(ceros(generador)));
+        }
+        // Un número de 60 caracteres que empieza 50 bytes antes del final del primer bloque
+        texto.append(BLOQUE - 50 - texto.size(), ' ');
+        escribir(7, 59);
+        while (texto.size() < 3 * BLOQUE) {
+            escribir(distribucion(generador), static_cast<std::size_t>(ceros(generador)));
+        }
+
+        std::FILE* flujo = std::tmpfile();
+        if (!flujo) {
+            std::cerr << "No se pudo crear un archivo temporal.\n";
+            return 1;
+        }
+        std::fwrite(texto.data(), 1, texto.size(), flujo);
+        std::rewind(flujo);
+        DatosEnteros<int32_t> leidos = leerEnterosDeFlujo<int32_t>(flujo);
+        std::fclose(flujo);
+        bool iguales = leidos.tamano() == esperados.size() &&
+                       std::equal(esperados.begin(), esperados.end(), leidos.datos());
+        std::cout << "Flujo por bloques con números partidos: " << leidos.tamano() << " enteros, "
+                  << (iguales ? "coinciden" : "NO coinciden") << "\n";
+        if (!iguales) {
+            return 1;
+        }
+    }
+
+    // Los errores de formato indican la posición del problema
+    try {
+        std::vector<int32_t> salida;
+        const std::string malo = "12 34 5x6";
+        analizarEnteros(malo.data(), malo.data() + malo.size(), salida);
+    } catch (const std::runtime_error& e) {
+        std::cout << "Error esperado: " << e.what() << "\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,303 @@
+/**
+ * @file EnteroGrande.hpp
+ * @brief Definición de la clase EnteroGrande, un entero sin signo de precisión arbitraria.
+ * Los dígitos se guardan en base 10^9 (nueve cifras decimales por palabra de 32 bits), de modo que
+ * convertirlo a texto no requiere divisiones. La multiplicación usa Karatsuba para números grandes
+ * y puede repartir sus tres submultiplicaciones entre hilos.
+ */
+#ifndef ENTEROGRANDE_HPP
+#define ENTEROGRANDE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Operaciones sobre números en base 10^9 guardados del dígito menos significativo al más significativo.
+ * Un número normalizado no tiene ceros a la izquierda; el cero es el arreglo vacío.
+ */
+namespace digitos {
+
+using Digitos = std::vector<std::uint32_t>;
+
+const std::uint32_t BASE = 1000000000u;
+
+/// Por debajo de esta cantidad de dígitos la multiplicación escolar es más rápida que Karatsuba.
+const std::size_t UMBRAL_KARATSUBA = 40;
+
+/// Por debajo de esta cantidad de dígitos no vale la pena lanzar hilos para una multiplicación.
+const std::size_t UMBRAL_PARALELO = 2000;
+
+inline void normalizar(Digitos& a) {
+    while (!a.empty() && a.back() == 0) {
+        a.pop_back();
+    }
+}
+
+/**
+ * @brief Copia los dígitos [inicio, fin) de a, sin ceros a la izquierda.
+ */
+inline Digitos tramo(const Digitos& a, std::size_t inicio, std::size_t fin) {
+    if (inicio >= a.size()) {
+        return Digitos();
+    }
+    Digitos resultado(a.begin() + static_cast<std::ptrdiff_t>(inicio), a.begin() + static_cast<std::ptrdiff_t>(fin < a.size() ? fin : a.size()));
+    normalizar(resultado);
+    return resultado;
+}
+
+inline Digitos sumar(const Digitos& a, const Digitos& b) {
+    const Digitos& mayor = a.size() >= b.size() ? a : b;
+    const Digitos& menor = a.size() >= b.size() ? b : a;
+    Digitos resultado(mayor.size() + 1);
+    std::uint32_t acarreo = 0;
+    for (std::size_t i = 0; i < mayor.size(); ++i) {
+        std::uint32_t s = mayor[i] + (i < menor.size() ? menor[i] : 0) + acarreo;
+        acarreo = s >= BASE;
+        resultado[i] = acarreo ? s - BASE : s;
+    }
+    resultado[mayor.size()] = acarreo;
+    normalizar(resultado);
+    return resultado;
+}
+
+/**
+ * @brief a -= b; requiere a >= b.
+ */
+inline void restarEnSitio(Digitos& a, const Digitos& b) {
+    std::uint32_t prestamo = 0;
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        std::uint32_t resta = (i < b.size() ? b[i] : 0) + prestamo;
+        if (resta == 0 && i >= b.size()) {
+            break;
+        }
+        if (a[i] >= resta) {
+            a[i] -= resta;
+            prestamo = 0;
+        } else {
+            a[i] = a[i] + BASE - resta;
+            prestamo = 1;
+        }
+    }
+    normalizar(a);
+}
+
+/**
+ * @brief destino += x * BASE^desplazamiento; destino debe tener espacio suficiente.
+ */
+inline void sumarDesplazado(Digitos& destino, const Digitos& x, std::size_t desplazamiento) {
+    std::uint32_t acarreo = 0;
+    std::size_t i = 0;
+    for (; i < x.size(); ++i) {
+        std::uint32_t s = destino[desplazamiento + i] + x[i] + acarreo;
+        acarreo = s >= BASE;
+        destino[desplazamiento + i] = acarreo ? s - BASE : s;
+    }
+    for (std::size_t j = desplazamiento + i; acarreo && j < destino.size(); ++j) {
+        std::uint32_t s = destino[j] + 1;
+        acarreo = s >= BASE;
+        destino[j] = acarreo ? 0 : s;
+    }
+}
+
+/**
+ * @brief Multiplicación escolar en O(n·m).
+ * Cada producto de dos dígitos es menor que 10^18 y cabe en 64 bits junto con el acarreo.
+ */
+inline Digitos multiplicarEscolar(const Digitos& a, const Digitos& b) {
+    if (a.empty() || b.empty()) {
+        return Digitos();
+    }
+    Digitos resultado(a.size() + b.size(), 0);
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        std::uint64_t acarreo = 0;
+        const std::uint64_t ai = a[i];
+        if (ai == 0) {
+            continue;
+        }
+        for (std::size_t j = 0; j < b.size(); ++j) {
+            std::uint64_t actual = resultado[i + j] + ai * b[j] + acarreo;
+            resultado[i + j] = static_cast<std::uint32_t>(actual % BASE);
+            acarreo = actual / BASE;
+        }
+        for (std::size_t k = i + b.size(); acarreo != 0; ++k) {
+            std::uint64_t actual = resultado[k] + acarreo;
+            resultado[k] = static_cast<std::uint32_t>(actual % BASE);
+            acarreo = actual / BASE;
+        }
+    }
+    normalizar(resultado);
+    return resultado;
+}
+
+/**
+ * @brief Multiplica por un número pequeño (menor que 2^32) en sitio.
+ */
+inline void multiplicarPorPequeno(Digitos& a, std::uint32_t factor) {
+    if (factor == 0) {
+        a.clear();
+        return;
+    }
+    std::uint64_t acarreo = 0;
+    for (std::uint32_t& d : a) {
+        std::uint64_t actual = static_cast<std::uint64_t>(d) * factor + acarreo;
+        d = static_cast<std::uint32_t>(actual % BASE);
+        acarreo = actual / BASE;
+    }
+    while (acarreo != 0) {
+        a.push_back(static_cast<std::uint32_t>(acarreo % BASE));
+        acarreo /= BASE;
+    }
+}
+
+/**
+ * @brief Multiplicación de Karatsuba: tres productos de la mitad del tamaño en lugar de cuatro, O(n^1.585).
+ * Con a = a1·B^m + a0 y b = b1·B^m + b0:
+ * a·b = z2·B^2m + (z1 - z2 - z0)·B^m + z0, con z0 = a0·b0, z2 = a1·b1 y z1 = (a0 + a1)(b0 + b1).
+ * @param hilos Cuántos hilos puede usar esta multiplicación; con más de uno, z0 y z2 se calculan en paralelo.
+ */
+inline Digitos multiplicar(const Digitos& a, const Digitos& b, unsigned hilos = 1) {
+    if (a.size() < b.size()) {
+        return multiplicar(b, a, hilos);
+    }
+    if (b.size() < UMBRAL_KARATSUBA) {
+        return multiplicarEscolar(a, b);
+    }
+    if (a.size() >= 2 * b.size()) {
+        // Tamaños muy distintos: se parte a en trozos del tamaño de b y se multiplica cada uno
+        Digitos resultado(a.size() + b.size() + 1, 0);
+        for (std::size_t inicio = 0; inicio < a.size(); inicio += b.size()) {
+            Digitos parcial = multiplicar(tramo(a, inicio, inicio + b.size()), b, hilos);
+            sumarDesplazado(resultado, parcial, inicio);
+        }
+        normalizar(resultado);
+        return resultado;
+    }
+    const std::size_t m = a.size() / 2;
+    Digitos a0 = tramo(a, 0, m), a1 = tramo(a, m, a.size());
+    Digitos b0 = tramo(b, 0, m), b1 = tramo(b, m, b.size());
+
+    Digitos z0, z1, z2;
+    if (hilos > 1 && b.size() >= UMBRAL_PARALELO) {
+        // Los tres productos son independientes: dos van a otros hilos y el tercero se queda en este
+        unsigned restantes = hilos / 3 > 1 ? hilos / 3 : 1;
+        std::future<Digitos> f0 = std::async(std::launch::async, [&] { return multiplicar(a0, b0, restantes); });
+        std::future<Digitos> f2 = std::async(std::launch::async, [&] { return multiplicar(a1, b1, restantes); });
+        z1 = multiplicar(sumar(a0, a1), sumar(b0, b1), restantes);
+        z0 = f0.get();
+        z2 = f2.get();
+    } else {
+        z0 = multiplicar(a0, b0);
+        z2 = multiplicar(a1, b1);
+        z1 = multiplicar(sumar(a0, a1), sumar(b0, b1));
+    }
+    restarEnSitio(z1, z0);
+    restarEnSitio(z1, z2);
+
+    Digitos resultado(a.size() + b.size() + 1, 0);
+    sumarDesplazado(resultado, z0, 0);
+    sumarDesplazado(resultado, z1, m);
+    sumarDesplazado(resultado, z2, 2 * m);
+    normalizar(resultado);
+    return resultado;
+}
+
+} // namespace digitos
+
+/**
+ * @class EnteroGrande
+ * @brief Entero sin signo de tamaño arbitrario.
+ */
+class EnteroGrande {
+    private:
+        digitos::Digitos valor; ///< Dígitos en base 10^9, del menos al más significativo.
+
+        explicit EnteroGrande(digitos::Digitos d) : valor(std::move(d)) {}
+
+    public:
+        /**
+         * @brief Construye el entero a partir de un número de 64 bits.
+         */
+        EnteroGrande(std::uint64_t n = 0) {
+            while (n != 0) {
+                valor.push_back(static_cast<std::uint32_t>(n % digitos::BASE));
+                n /= digitos::BASE;
+            }
+        }
+
+        /**
+         * @brief Producto de dos enteros grandes.
+         * @param hilos Hilos que puede usar la multiplicación (1 = secuencial).
+         */
+        static EnteroGrande multiplicar(const EnteroGrande& a, const EnteroGrande& b, unsigned hilos = 1) {
+            return EnteroGrande(digitos::multiplicar(a.valor, b.valor, hilos));
+        }
+
+        EnteroGrande& operator*=(std::uint32_t factor) {
+            digitos::multiplicarPorPequeno(valor, factor);
+            return *this;
+        }
+
+        friend EnteroGrande operator*(const EnteroGrande& a, const EnteroGrande& b) {
+            return multiplicar(a, b);
+        }
+
+        friend EnteroGrande operator+(const EnteroGrande& a, const EnteroGrande& b) {
+            return EnteroGrande(digitos::sumar(a.valor, b.valor));
+        }
+
+        friend bool operator==(const EnteroGrande& a, const EnteroGrande& b) {
+            return a.valor == b.valor;
+        }
+
+        friend bool operator!=(const EnteroGrande& a, const EnteroGrande& b) {
+            return !(a == b);
+        }
+
+        bool esCero() const { return valor.empty(); }
+
+        /**
+         * @brief Cantidad de cifras decimales (el cero tiene una).
+         */
+        std::size_t numeroDeCifras() const {
+            if (valor.empty()) {
+                return 1;
+            }
+            std::size_t cifras = (valor.size() - 1) * 9;
+            for (std::uint32_t d = valor.back(); d != 0; d /= 10) {
+                ++cifras;
+            }
+            return cifras;
+        }
+
+        /**
+         * @brief Representación decimal. Como la base es 10^9, cada dígito se escribe directo con 9 cifras.
+         */
+        std::string aCadena() const {
+            if (valor.empty()) {
+                return "0";
+            }
+            std::string resultado = std::to_string(valor.back());
+            resultado.reserve(numeroDeCifras());
+            char bloque[9];
+            for (std::size_t i = valor.size() - 1; i-- > 0;) {
+                std::uint32_t d = valor[i];
+                for (int k = 8; k >= 0; --k) {
+                    bloque[k] = static_cast<char>('0' + d % 10);
+                    d /= 10;
+                }
+                resultado.append(bloque, 9);
+            }
+            return resultado;
+        }
+
+        friend std::ostream& operator<<(std::ostream& os, const EnteroGrande& n) {
+            return os << n.aCadena();
+        }
+};
+
+#endif
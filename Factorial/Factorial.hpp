@@ -0,0 +1,229 @@
+/**
+ * @file Factorial.hpp
+ * @brief Factoriales y coeficientes binomiales exactos con EnteroGrande.
+ * En lugar de multiplicar 1·2·3·...·n de izquierda a derecha (un número cada vez más grande por uno pequeño),
+ * los factores se multiplican en un árbol de productos (división binaria): cada nivel multiplica números de
+ * tamaño parecido, que es donde Karatsuba rinde. Incluye una versión paralela y una tabla memoizada.
+ */
+#ifndef FACTORIAL_HPP
+#define FACTORIAL_HPP
+
+#include "EnteroGrande.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Junta factores consecutivos mientras su producto quepa en 32 bits, para tener menos hojas en el árbol.
+ */
+inline std::vector<std::uint32_t> agruparFactores(const std::vector<std::uint64_t>& factores) {
+    std::vector<std::uint32_t> grupos;
+    std::uint64_t actual = 1;
+    for (std::uint64_t f : factores) {
+        if (f > UINT32_MAX) {
+            throw std::invalid_argument("Cada factor debe caber en 32 bits.");
+        }
+        if (actual * f > UINT32_MAX) {
+            grupos.push_back(static_cast<std::uint32_t>(actual));
+            actual = 1;
+        }
+        actual *= f;
+    }
+    if (actual != 1 || grupos.empty()) {
+        grupos.push_back(static_cast<std::uint32_t>(actual));
+    }
+    return grupos;
+}
+
+/**
+ * @brief Producto de grupos[inicio, fin) por división binaria.
+ * Las hojas de hasta 16 grupos se multiplican directamente con multiplicarPorPequeno.
+ */
+inline EnteroGrande productoArbol(const std::vector<std::uint32_t>& grupos, std::size_t inicio, std::size_t fin) {
+    if (fin - inicio <= 16) {
+        EnteroGrande resultado(1);
+        for (std::size_t i = inicio; i < fin; ++i) {
+            resultado *= grupos[i];
+        }
+        return resultado;
+    }
+    std::size_t medio = inicio + (fin - inicio) / 2;
+    return productoArbol(grupos, inicio, medio) * productoArbol(grupos, medio, fin);
+}
+
+/**
+ * @brief Multiplica los parciales[inicio, fin) en árbol, repartiendo los hilos entre las dos mitades.
+ */
+inline EnteroGrande combinarParciales(const std::vector<EnteroGrande>& parciales, std::size_t inicio, std::size_t fin, unsigned hilos) {
+    if (fin - inicio == 1) {
+        return parciales[inicio];
+    }
+    std::size_t medio = inicio + (fin - inicio) / 2;
+    unsigned mitad = hilos > 1 ? hilos / 2 : 1;
+    std::future<EnteroGrande> izquierda = std::async(std::launch::async, [&] {
+        return combinarParciales(parciales, inicio, medio, mitad);
+    });
+    EnteroGrande derecha = combinarParciales(parciales, medio, fin, mitad);
+    // La última multiplicación, la más cara, puede usar todos los hilos
+    return EnteroGrande::multiplicar(izquierda.get(), derecha, hilos);
+}
+
+/**
+ * @brief Producto exacto de una lista de factores (cada uno menor que 2^32).
+ * @param hilos 1 para calcularlo en este hilo; 0 para usar todos los núcleos.
+ */
+inline EnteroGrande productoDeFactores(const std::vector<std::uint64_t>& factores, unsigned hilos = 1) {
+    if (hilos == 0) {
+        hilos = std::max(1u, std::thread::hardware_concurrency());
+    }
+    std::vector<std::uint32_t> grupos = agruparFactores(factores);
+    // Con pocos grupos no compensa crear hilos
+    hilos = static_cast<unsigned>(std::min<std::size_t>(hilos, std::max<std::size_t>(1, grupos.size() / 1024)));
+    if (hilos == 1) {
+        return productoArbol(grupos, 0, grupos.size());
+    }
+    // Cada hilo toma los grupos t, t + hilos, t + 2·hilos, ...: así todos reciben factores de tamaño parecido
+    std::vector<std::vector<std::uint32_t>> porHilo(hilos);
+    for (std::size_t i = 0; i < grupos.size(); ++i) {
+        porHilo[i % hilos].push_back(grupos[i]);
+    }
+    std::vector<EnteroGrande> parciales(hilos);
+    std::vector<std::thread> trabajadores;
+    for (unsigned t = 0; t < hilos; ++t) {
+        trabajadores.emplace_back([&parciales, &porHilo, t] {
+            parciales[t] = productoArbol(porHilo[t], 0, porHilo[t].size());
+        });
+    }
+    for (std::thread& trabajador : trabajadores) {
+        trabajador.join();
+    }
+    return combinarParciales(parciales, 0, parciales.size(), hilos);
+}
+
+/**
+ * @brief Factorial exacto de n, calculado en este hilo.
+ * Hasta 20! cabe en 64 bits y se resuelve con un ciclo.
+ */
+inline EnteroGrande factorialExacto(std::uint32_t n) {
+    if (n <= 20) {
+        std::uint64_t resultado = 1;
+        for (std::uint32_t i = 2; i <= n; ++i) {
+            resultado *= i;
+        }
+        return EnteroGrande(resultado);
+    }
+    std::vector<std::uint64_t> factores;
+    factores.reserve(n - 1);
+    for (std::uint64_t i = 2; i <= n; ++i) {
+        factores.push_back(i);
+    }
+    return productoDeFactores(factores, 1);
+}
+
+/**
+ * @brief Factorial exacto de n repartiendo el producto entre hilos.
+ * @param hilos Cantidad de hilos; 0 usa todos los núcleos.
+ */
+inline EnteroGrande factorialParalelo(std::uint32_t n, unsigned hilos = 0) {
+    if (n <= 20) {
+        return factorialExacto(n);
+    }
+    std::vector<std::uint64_t> factores;
+    factores.reserve(n - 1);
+    for (std::uint64_t i = 2; i <= n; ++i) {
+        factores.push_back(i);
+    }
+    return productoDeFactores(factores, hilos);
+}
+
+/**
+ * @brief Coeficiente binomial C(n, k) exacto, sin divisiones.
+ * Por la fórmula de Legendre, el exponente del primo p en C(n, k) es
+ * la suma sobre i de floor(n/p^i) - floor(k/p^i) - floor((n-k)/p^i); el resultado es el producto de esas potencias.
+ * @param hilos 1 para calcularlo en este hilo; 0 para usar todos los núcleos.
+ */
+inline EnteroGrande coeficienteBinomial(std::uint32_t n, std::uint32_t k, unsigned hilos = 1) {
+    if (k > n) {
+        return EnteroGrande(0);
+    }
+    // Criba de Eratóstenes hasta n
+    std::vector<bool> compuesto(static_cast<std::size_t>(n) + 1, false);
+    std::vector<std::uint64_t> factores;
+    for (std::uint64_t p = 2; p <= n; ++p) {
+        if (compuesto[p]) {
+            continue;
+        }
+        for (std::uint64_t multiplo = p * p; multiplo <= n; multiplo += p) {
+            compuesto[multiplo] = true;
+        }
+        std::uint64_t exponente = 0;
+        for (std::uint64_t potencia = p; potencia <= n; potencia *= p) {
+            exponente += n / potencia - k / potencia - (n - k) / potencia;
+        }
+        for (std::uint64_t e = 0; e < exponente; ++e) {
+            factores.push_back(p);
+        }
+    }
+    return productoDeFactores(factores, hilos);
+}
+
+/**
+ * @class TablaFactoriales
+ * @brief Factoriales memoizados para consultas repetidas de valores pequeños.
+ * Cada factorial nuevo se obtiene del anterior con una sola multiplicación por un número pequeño.
+ * Las referencias devueltas siguen siendo válidas aunque la tabla crezca (se guarda en un std::deque).
+ * Es segura para usarse desde varios hilos.
+ */
+class TablaFactoriales {
+    private:
+        std::deque<EnteroGrande> calculados; ///< calculados[i] = i!
+        std::uint32_t limite;                ///< Mayor n que se guarda en la tabla.
+        mutable std::mutex cerrojo;
+
+    public:
+        /**
+         * @brief Constructor de la clase TablaFactoriales.
+         * @param limiteTabla Mayor n que se memoiza; los factoriales más grandes se calculan sin guardarse.
+         */
+        explicit TablaFactoriales(std::uint32_t limiteTabla = 2000) : calculados(1, EnteroGrande(1)), limite(limiteTabla) {}
+
+        /**
+         * @brief Devuelve n!, calculándolo y guardándolo si hace falta.
+         * @throws std::out_of_range Si n supera el límite de la tabla (use factorialExacto para esos casos).
+         */
+        const EnteroGrande& obtener(std::uint32_t n) {
+            if (n > limite) {
+                throw std::out_of_range("n supera el límite de la tabla de factoriales.");
+            }
+            std::lock_guard<std::mutex> guardia(cerrojo);
+            while (calculados.size() <= n) {
+                EnteroGrande siguiente = calculados.back();
+                siguiente *= static_cast<std::uint32_t>(calculados.size());
+                calculados.push_back(std::move(siguiente));
+            }
+            return calculados[n];
+        }
+
+        /**
+         * @brief n! desde la tabla si n está dentro del límite; si no, con factorialExacto.
+         */
+        EnteroGrande factorial(std::uint32_t n) {
+            if (n > limite) {
+                return factorialExacto(n);
+            }
+            return obtener(n);
+        }
+
+        std::size_t tamano() const {
+            std::lock_guard<std::mutex> guardia(cerrojo);
+            return calculados.size();
+        }
+};
+
+#endif
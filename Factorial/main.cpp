@@ -0,0 +1,68 @@
+/**
+ * @file main.cpp
+ * @brief Programa de ejemplo de los factoriales exactos.
+ * Compara el factorial con unsigned long long (que se desborda después de 20!) contra EnteroGrande,
+ * mide el árbol de productos secuencial y paralelo, y usa la tabla memoizada y los coeficientes binomiales.
+ */
+#include "Factorial.hpp"
+#include <chrono>
+#include <iostream>
+
+namespace {
+double milisegundosDesde(std::chrono::steady_clock::time_point inicio) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - inicio).count();
+}
+
+unsigned long long factorialIngenuo(unsigned int n) {
+    unsigned long long resultado = 1;
+    for (unsigned int i = 2; i <= n; ++i) {
+        resultado *= i;
+    }
+    return resultado;
+}
+}
+
+int main() {
+    std::cout << "21! con unsigned long long: " << factorialIngenuo(21) << " (desbordado)\n";
+    std::cout << "21! con EnteroGrande:       " << factorialExacto(21) << "\n";
+    std::cout << "100! = " << factorialExacto(100) << "\n";
+
+    const std::uint32_t N = 100000;
+    auto inicio = std::chrono::steady_clock::now();
+    EnteroGrande secuencial = factorialExacto(N);
+    double msSecuencial = milisegundosDesde(inicio);
+
+    inicio = std::chrono::steady_clock::now();
+    EnteroGrande paralelo = factorialParalelo(N);
+    double msParalelo = milisegundosDesde(inicio);
+
+    // Multiplicar de uno en uno: cada paso recorre un número cada vez más largo, O(n^2) en total
+    const std::uint32_t M = 20000;
+    inicio = std::chrono::steady_clock::now();
+    EnteroGrande ingenuo(1);
+    for (std::uint32_t i = 2; i <= M; ++i) {
+        ingenuo *= i;
+    }
+    double msIngenuo = milisegundosDesde(inicio);
+
+    std::cout << N << "! tiene " << secuencial.numeroDeCifras() << " cifras\n";
+    std::cout << "Árbol de productos:           " << msSecuencial << " ms\n";
+    std::cout << "Árbol de productos paralelo:  " << msParalelo << " ms (" << std::thread::hardware_concurrency()
+              << " núcleos, " << (secuencial == paralelo ? "mismo resultado" : "RESULTADO DISTINTO") << ")\n";
+    std::cout << "De uno en uno hasta " << M << "!:     " << msIngenuo << " ms\n";
+
+    TablaFactoriales tabla;
+    inicio = std::chrono::steady_clock::now();
+    std::size_t cifras = 0;
+    for (int repeticion = 0; repeticion < 1000; ++repeticion) {
+        cifras += tabla.obtener(static_cast<std::uint32_t>(repeticion % 500)).numeroDeCifras();
+    }
+    std::cout << "1000 consultas a la tabla: " << milisegundosDesde(inicio) << " ms (" << cifras << " cifras en total)\n";
+
+    std::cout << "C(100, 50) = " << coeficienteBinomial(100, 50) << "\n";
+    inicio = std::chrono::steady_clock::now();
+    EnteroGrande binomial = coeficienteBinomial(1000000, 500000, 0);
+    std::cout << "C(1000000, 500000) tiene " << binomial.numeroDeCifras() << " cifras (" << milisegundosDesde(inicio) << " ms)\n";
+
+    return 0;
+}
@@ -0,0 +1,291 @@
+/**
+ * @file Algoritmos.hpp
+ * @brief Algoritmos sobre grafos: orden topológico, componentes fuertemente conexas, ciclos y bipartición.
+ * @details Todos son iterativos (un grafo de dependencias largo no desborda la pila de llamadas) y guardan su estado
+ * en arreglos densos indexados por vértice, sin tablas hash. Funcionan con GrafoCsr o con cualquier tipo que ofrezca
+ * numeroVertices(), esDirigido() y vecinos(v) como un rango de IdVertice.
+ */
+#ifndef ALGORITMOS_HPP
+#define ALGORITMOS_HPP
+#include "GrafoCsr.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <vector>
+
+/// Marca de "sin valor" en los arreglos indexados por vértice.
+constexpr IdVertice SIN_VERTICE = std::numeric_limits<IdVertice>::max();
+
+/**
+ * @brief Resultado de ordenTopologico().
+ */
+struct OrdenTopologico {
+    std::vector<IdVertice> orden; ///< Vértices en orden topológico; si hay ciclos, sólo los que no dependen de uno.
+    bool esAciclico = true;       ///< false si algún vértice quedó fuera de orden por estar en un ciclo o depender de él.
+};
+
+/**
+ * @brief Orden topológico con el algoritmo de Kahn: cada vértice aparece después de todos sus predecesores.
+ * @param grafo Grafo dirigido; en uno no dirigido cada arista forma un ciclo de dos vértices.
+ * @return Orden y si el grafo es acíclico. El propio arreglo del orden hace de cola, así que sólo se reservan
+ * ese arreglo y el de grados de entrada. O(n + m).
+ */
+template <typename G>
+OrdenTopologico ordenTopologico(const G& grafo) {
+    const std::size_t n = grafo.numeroVertices();
+    std::vector<IdVertice> entrantes(n, 0);
+    for (std::size_t v = 0; v < n; ++v) {
+        for (IdVertice w : grafo.vecinos(static_cast<IdVertice>(v))) {
+            entrantes[w]++;
+        }
+    }
+    OrdenTopologico resultado;
+    resultado.orden.reserve(n);
+    for (std::size_t v = 0; v < n; ++v) {
+        if (entrantes[v] == 0) {
+            resultado.orden.push_back(static_cast<IdVertice>(v));
+        }
+    }
+    for (std::size_t i = 0; i < resultado.orden.size(); ++i) {
+        for (IdVertice w : grafo.vecinos(resultado.orden[i])) {
+            if (--entrantes[w] == 0) {
+                resultado.orden.push_back(w);
+            }
+        }
+    }
+    resultado.esAciclico = resultado.orden.size() == n;
+    return resultado;
+}
+
+/**
+ * @brief Resultado de componentesFuertes().
+ */
+struct ComponentesFuertes {
+    std::vector<IdVertice> componente; ///< Componente de cada vértice, de 0 a cantidad - 1.
+    std::size_t cantidad = 0;          ///< Número de componentes.
+};
+
+/**
+ * @brief Componentes fuertemente conexas con el algoritmo de Tarjan, sin recursión.
+ * @param grafo Grafo dirigido; en uno no dirigido da las componentes conexas.
+ * @return Componente de cada vértice. Las componentes salen en orden topológico inverso: si hay una arista
+ * de la componente a a la b (a != b), entonces a > b. O(n + m).
+ *
+ * La recursión se reemplaza por una pila de marcos, cada uno con el vértice y la posición de su siguiente vecino por
+ * visitar. Un vértice está en la pila de Tarjan si ya tiene índice pero todavía no tiene componente, así que no hace
+ * falta un arreglo aparte para saberlo.
+ */
+template <typename G>
+ComponentesFuertes componentesFuertes(const G& grafo) {
+    using Iterador = decltype(std::begin(grafo.vecinos(IdVertice())));
+    struct Marco {
+        IdVertice vertice;
+        Iterador siguiente;
+        Iterador fin;
+    };
+
+    const std::size_t n = grafo.numeroVertices();
+    std::vector<IdVertice> indice(n, SIN_VERTICE);
+    std::vector<IdVertice> bajo(n, 0);
+    ComponentesFuertes resultado;
+    resultado.componente.assign(n, SIN_VERTICE);
+    std::vector<IdVertice> pila;
+    std::vector<Marco> marcos;
+    IdVertice contador = 0;
+
+    auto descubrir = [&](IdVertice v) {
+        indice[v] = bajo[v] = contador++;
+        pila.push_back(v);
+        auto vecinos = grafo.vecinos(v);
+        marcos.push_back({v, std::begin(vecinos), std::end(vecinos)});
+    };
+
+    for (std::size_t raiz = 0; raiz < n; ++raiz) {
+        if (indice[raiz] != SIN_VERTICE) {
+            continue;
+        }
+        descubrir(static_cast<IdVertice>(raiz));
+        while (!marcos.empty()) {
+            Marco& marco = marcos.back();
+            IdVertice v = marco.vertice;
+            if (marco.siguiente != marco.fin) {
+                IdVertice w = *marco.siguiente;
+                ++marco.siguiente;
+                if (indice[w] == SIN_VERTICE) {
+                    descubrir(w); // Invalida la referencia marco
+                } else if (resultado.componente[w] == SIN_VERTICE) {
+                    // w sigue en la pila: es un ancestro o está en la misma componente
+                    bajo[v] = std::min(bajo[v], indice[w]);
+                }
+                continue;
+            }
+            // Se terminaron los vecinos de v
+            if (bajo[v] == indice[v]) {
+                IdVertice w;
+                do {
+                    w = pila.back();
+                    pila.pop_back();
+                    resultado.componente[w] = static_cast<IdVertice>(resultado.cantidad);
+                } while (w != v);
+                resultado.cantidad++;
+            }
+            marcos.pop_back();
+            if (!marcos.empty()) {
+                IdVertice padre = marcos.back().vertice;
+                bajo[padre] = std::min(bajo[padre], bajo[v]);
+            }
+        }
+    }
+    return resultado;
+}
+
+/**
+ * @brief Busca un ciclo con un recorrido en profundidad iterativo.
+ * @param grafo Grafo dirigido o no dirigido. En uno no dirigido no cuenta como ciclo volver por la misma arista
+ * al padre, pero sí dos aristas paralelas entre los mismos vértices.
+ * @return Los vértices de un ciclo en el orden en que se recorren (el último vuelve al primero), o un arreglo vacío
+ * si el grafo es acíclico. Un lazo de un vértice a sí mismo es un ciclo de un vértice. O(n + m).
+ */
+template <typename G>
+std::vector<IdVertice> buscarCiclo(const G& grafo) {
+    using Iterador = decltype(std::begin(grafo.vecinos(IdVertice())));
+    struct Marco {
+        IdVertice vertice;
+        Iterador siguiente;
+        Iterador fin;
+        bool saltoPadre; ///< En un grafo no dirigido, si ya se ignoró la arista por la que se llegó.
+    };
+    enum Color : std::uint8_t { BLANCO, GRIS, NEGRO };
+
+    const std::size_t n = grafo.numeroVertices();
+    const bool dirigido = grafo.esDirigido();
+    std::vector<std::uint8_t> color(n, BLANCO);
+    std::vector<IdVertice> padre(n, SIN_VERTICE);
+    std::vector<Marco> marcos;
+
+    for (std::size_t raiz = 0; raiz < n; ++raiz) {
+        if (color[raiz] != BLANCO) {
+            continue;
+        }
+        auto vecinosRaiz = grafo.vecinos(static_cast<IdVertice>(raiz));
+        marcos.push_back({static_cast<IdVertice>(raiz), std::begin(vecinosRaiz), std::end(vecinosRaiz), false});
+        color[raiz] = GRIS;
+        while (!marcos.empty()) {
+            Marco& marco = marcos.back();
+            IdVertice v = marco.vertice;
+            if (marco.siguiente == marco.fin) {
+                color[v] = NEGRO;
+                marcos.pop_back();
+                continue;
+            }
+            IdVertice w = *marco.siguiente;
+            ++marco.siguiente;
+            if (!dirigido && w == padre[v] && !marco.saltoPadre) {
+                marco.saltoPadre = true;
+                continue;
+            }
+            if (color[w] == GRIS) {
+                // w es un ancestro de v (o v mismo): el ciclo es el camino de w a v más la arista v -> w
+                std::vector<IdVertice> ciclo;
+                for (IdVertice x = v; x != w; x = padre[x]) {
+                    ciclo.push_back(x);
+                }
+                ciclo.push_back(w);
+                std::reverse(ciclo.begin(), ciclo.end());
+                return ciclo;
+            }
+            if (color[w] == BLANCO) {
+                color[w] = GRIS;
+                padre[w] = v;
+                auto vecinos = grafo.vecinos(w);
+                marcos.push_back({w, std::begin(vecinos), std::end(vecinos), false}); // Invalida la referencia marco
+            }
+        }
+    }
+    return {};
+}
+
+/**
+ * @brief Resultado de biparticion().
+ */
+struct Biparticion {
+    bool esBipartito = true;
+    std::vector<std::uint8_t> lado; ///< 0 o 1 para cada vértice; vacío si el grafo no es bipartito.
+};
+
+/**
+ * @brief Decide si los vértices se pueden repartir en dos lados de modo que toda arista una lados distintos.
+ * @param grafo Grafo dirigido o no dirigido; la dirección de las aristas no importa.
+ * @return Si es bipartito y, en ese caso, el lado de cada vértice.
+ *
+ * Usa conjuntos disjuntos con paridad: cada vértice guarda su padre y si está del mismo lado que él. Unir los extremos
+ * de una arista que ya están en el mismo conjunto y del mismo lado revela un ciclo impar. A diferencia de colorear
+ * con BFS, no hace falta recorrer las aristas al revés, así que en un grafo dirigido no se necesita la transpuesta.
+ * Con unión por rango y compresión de caminos cuesta O(m α(n)), con tres arreglos: padres, paridades y rangos.
+ */
+template <typename G>
+Biparticion biparticion(const G& grafo) {
+    const std::size_t n = grafo.numeroVertices();
+    std::vector<IdVertice> padre(n);
+    std::vector<std::uint8_t> paridad(n, 0); // Paridad respecto del padre; tras comprimir, respecto de la raíz
+    std::vector<std::uint8_t> rango(n, 0);   // Cota de la altura de cada raíz; nunca pasa de log2(n) < 64
+    for (std::size_t v = 0; v < n; ++v) {
+        padre[v] = static_cast<IdVertice>(v);
+    }
+
+    // Devuelve la raíz de v y la paridad de v respecto de ella, comprimiendo el camino
+    auto encontrar = [&](IdVertice v) {
+        IdVertice raiz = v;
+        std::uint8_t paridadTotal = 0;
+        while (padre[raiz] != raiz) {
+            paridadTotal ^= paridad[raiz];
+            raiz = padre[raiz];
+        }
+        IdVertice actual = v;
+        std::uint8_t paridadActual = paridadTotal;
+        while (padre[actual] != raiz && actual != raiz) {
+            IdVertice siguiente = padre[actual];
+            std::uint8_t paridadSiguiente = paridadActual ^ paridad[actual];
+            padre[actual] = raiz;
+            paridad[actual] = paridadActual;
+            actual = siguiente;
+            paridadActual = paridadSiguiente;
+        }
+        return std::make_pair(raiz, paridadTotal);
+    };
+
+    Biparticion resultado;
+    for (std::size_t v = 0; v < n; ++v) {
+        for (IdVertice w : grafo.vecinos(static_cast<IdVertice>(v))) {
+            auto [raizV, paridadV] = encontrar(static_cast<IdVertice>(v));
+            auto [raizW, paridadW] = encontrar(w);
+            if (raizV == raizW) {
+                if (paridadV == paridadW) {
+                    resultado.esBipartito = false;
+                    return resultado;
+                }
+            } else {
+                // Los extremos deben quedar en lados distintos; la raíz de menor rango cuelga de la otra
+                if (rango[raizV] > rango[raizW]) {
+                    std::swap(raizV, raizW);
+                }
+                padre[raizV] = raizW;
+                paridad[raizV] = paridadV ^ paridadW ^ 1;
+                if (rango[raizV] == rango[raizW]) {
+                    rango[raizW]++;
+                }
+            }
+        }
+    }
+    for (std::size_t v = 0; v < n; ++v) {
+        encontrar(static_cast<IdVertice>(v));
+        // Tras comprimir, el padre de v es la raíz y su paridad es su lado (la raíz tiene paridad 0)
+    }
+    resultado.lado = std::move(paridad);
+    return resultado;
+}
+
+#endif
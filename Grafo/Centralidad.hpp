@@ -0,0 +1,381 @@
+/**
+ * @file Centralidad.hpp
+ * @brief PageRank (normal y personalizado) y estadísticas de grado sobre una instantánea GrafoCsr.
+ * @details PageRank se calcula "tirando" (pull): cada vértice suma las contribuciones de sus predecesores, leídas de la
+ * transpuesta. Así cada hilo sólo escribe en los rangos de sus propios vértices, sin atómicos ni candados.
+ * Los rangos y las contribuciones se guardan en arreglos contiguos de double, y los bucles por vértice no tienen
+ * dependencias entre iteraciones, así que el compilador puede vectorizarlos.
+ */
+#ifndef CENTRALIDAD_HPP
+#define CENTRALIDAD_HPP
+#include "GrafoCsr.hpp"
+#include "../Reduccion/Reduccion.hpp"
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Parámetros de PageRank.
+ */
+struct OpcionesPageRank {
+    double amortiguacion = 0.85;    ///< Probabilidad de seguir una arista en lugar de saltar a un vértice al azar.
+    double tolerancia = 1e-6;       ///< Se detiene cuando la suma de los cambios de rango (norma L1) es menor.
+    unsigned maximoIteraciones = 100;
+    unsigned hilos = 0;             ///< 0 usa los del procesador.
+};
+
+/**
+ * @brief Resultado de PageRank.
+ */
+struct ResultadoPageRank {
+    std::vector<double> rangos;     ///< Rango de cada vértice; suman 1.
+    unsigned iteraciones = 0;
+    double error = 0.0;             ///< Norma L1 del último cambio.
+    bool convergio = false;         ///< Si el error bajó de la tolerancia antes del máximo de iteraciones.
+};
+
+/**
+ * @class CalculadoraPageRank
+ * @brief Prepara un grafo para calcular PageRank varias veces (por ejemplo, personalizado para distintos vértices).
+ *
+ * Al construirla se arma la transpuesta (en un grafo dirigido) y el inverso del grado de salida de cada vértice.
+ * Cada iteración hace una sola pasada paralela: cada hilo toma un tramo contiguo de vértices con aproximadamente
+ * el mismo número de aristas entrantes, calcula sus rangos nuevos y deja listas sus contribuciones (rango / grado)
+ * para la iteración siguiente. Los vértices sin aristas de salida reparten su rango según el vector de salto.
+ * Los hilos se crean una vez por cálculo y se sincronizan con una barrera al empezar y al terminar cada iteración.
+ */
+class CalculadoraPageRank {
+private:
+    GrafoCsr entrantes;               ///< Predecesores de cada vértice.
+    std::vector<double> inversoGrado; ///< 1 / grado de salida, o 0 si el vértice no tiene aristas de salida.
+
+    /**
+     * @brief Sumas parciales de un hilo, cada una en su propia línea de caché para que los hilos no se disputen
+     * la misma línea al escribirlas.
+     */
+    struct alignas(64) Parcial {
+        double error = 0.0;
+        double colgante = 0.0;
+    };
+
+    /**
+     * @brief Barrera reutilizable: esperar() bloquea hasta que llegan todos los participantes.
+     * Lo que un hilo escribe antes de esperar() es visible para los demás después.
+     */
+    class Barrera {
+    private:
+        std::mutex candado;
+        std::condition_variable avance;
+        const unsigned participantes;
+        unsigned llegados = 0;
+        std::uint64_t generacion = 0;
+
+    public:
+        explicit Barrera(unsigned participantes) : participantes(participantes) {}
+
+        void esperar() {
+            std::unique_lock<std::mutex> guardia(candado);
+            const std::uint64_t actual = generacion;
+            if (++llegados == participantes) {
+                llegados = 0;
+                generacion++;
+                avance.notify_all();
+                return;
+            }
+            avance.wait(guardia, [&] { return generacion != actual; });
+        }
+    };
+
+    /**
+     * @brief Límites de los tramos de vértices, uno por hilo, con un costo parecido: cada vértice cuesta 1 más
+     * sus aristas entrantes. Se buscan con búsqueda binaria sobre los desplazamientos.
+     */
+    std::vector<std::size_t> repartir(unsigned hilos) const {
+        const std::size_t n = entrantes.numeroVertices();
+        const std::vector<std::size_t>& desplazamientos = entrantes.obtenerDesplazamientos();
+        const std::size_t costoTotal = n + entrantes.numeroAristas();
+        std::vector<std::size_t> limites(hilos + 1, n);
+        limites[0] = 0;
+        for (unsigned t = 1; t < hilos; ++t) {
+            const std::size_t objetivo = costoTotal * t / hilos;
+            std::size_t bajo = limites[t - 1], alto = n;
+            while (bajo < alto) {
+                std::size_t medio = bajo + (alto - bajo) / 2;
+                if (medio + desplazamientos[medio] < objetivo) {
+                    bajo = medio + 1;
+                } else {
+                    alto = medio;
+                }
+            }
+            limites[t] = bajo;
+        }
+        return limites;
+    }
+
+    /**
+     * @brief Suma de contribuciones de los predecesores, con cuatro acumuladores como sumarEscalar().
+     */
+    static double sumarContribuciones(const IdVertice* origen, const IdVertice* fin, const double* contribucion) {
+        double a0 = 0.0, a1 = 0.0, a2 = 0.0, a3 = 0.0;
+        for (; origen + 4 <= fin; origen += 4) {
+            a0 += contribucion[origen[0]];
+            a1 += contribucion[origen[1]];
+            a2 += contribucion[origen[2]];
+            a3 += contribucion[origen[3]];
+        }
+        for (; origen < fin; ++origen) {
+            a0 += contribucion[*origen];
+        }
+        return (a0 + a1) + (a2 + a3);
+    }
+
+    /**
+     * @brief Iteración de potencia compartida por calcular() y calcularPersonalizado().
+     * @param salto Distribución de salto normalizada, o vacía para la uniforme.
+     */
+    ResultadoPageRank iterar(const std::vector<double>& salto, const OpcionesPageRank& opciones) const {
+        const std::size_t n = entrantes.numeroVertices();
+        ResultadoPageRank resultado;
+        if (n == 0) {
+            resultado.convergio = true;
+            return resultado;
+        }
+        if (opciones.amortiguacion < 0.0 || opciones.amortiguacion >= 1.0) {
+            throw std::invalid_argument("La amortiguación de PageRank debe estar en [0, 1).");
+        }
+        const double d = opciones.amortiguacion;
+        const double uniforme = 1.0 / static_cast<double>(n);
+        const bool personalizado = !salto.empty();
+
+        unsigned hilos = hilosParaReduccion(n + entrantes.numeroAristas(), opciones.hilos);
+        const std::vector<std::size_t> limites = repartir(hilos);
+
+        // Estado inicial: el propio vector de salto
+        std::vector<double> rangos(n), nuevos(n), contribucion(n), contribucionNueva(n);
+        double colgante = 0.0; // Rango total de los vértices sin aristas de salida
+        for (std::size_t v = 0; v < n; ++v) {
+            rangos[v] = personalizado ? salto[v] : uniforme;
+            contribucion[v] = rangos[v] * inversoGrado[v];
+            colgante += inversoGrado[v] == 0.0 ? rangos[v] : 0.0;
+        }
+
+        const std::size_t* desplazamientos = entrantes.obtenerDesplazamientos().data();
+        const IdVertice* origenes = entrantes.obtenerDestinos().data();
+        const double* inverso = inversoGrado.data();
+        std::vector<Parcial> parciales(hilos);
+
+        // Estado de la iteración en curso; el hilo que llama lo escribe antes de abrir la barrera
+        double masaSalto = 0.0; // Rango que se reparte según el salto: el del salto aleatorio más el de los colgantes
+        bool terminar = false;
+        Barrera barrera(hilos);
+
+        auto tramo = [&](unsigned t) {
+            const double* contrib = contribucion.data();
+            double* nuevo = nuevos.data();
+            double* contribSiguiente = contribucionNueva.data();
+            const double* anterior = rangos.data();
+            double error = 0.0, colganteTramo = 0.0;
+            for (std::size_t v = limites[t]; v < limites[t + 1]; ++v) {
+                double base = masaSalto * (personalizado ? salto[v] : uniforme);
+                double rango = base + d * sumarContribuciones(origenes + desplazamientos[v],
+                                                              origenes + desplazamientos[v + 1], contrib);
+                nuevo[v] = rango;
+                contribSiguiente[v] = rango * inverso[v];
+                colganteTramo += inverso[v] == 0.0 ? rango : 0.0;
+                error += std::fabs(rango - anterior[v]);
+            }
+            parciales[t].error = error;
+            parciales[t].colgante = colganteTramo;
+        };
+
+        // Cada trabajador espera el inicio de una iteración, hace su tramo y espera a que terminen todos
+        auto trabajar = [&](unsigned t) {
+            while (true) {
+                barrera.esperar();
+                if (terminar) {
+                    return;
+                }
+                tramo(t);
+                barrera.esperar();
+            }
+        };
+        std::vector<std::thread> trabajadores;
+        trabajadores.reserve(hilos - 1);
+        for (unsigned t = 0; t + 1 < hilos; ++t) {
+            trabajadores.emplace_back(trabajar, t);
+        }
+
+        while (resultado.iteraciones < opciones.maximoIteraciones) {
+            masaSalto = (1.0 - d) + d * colgante;
+            barrera.esperar();
+            tramo(hilos - 1);
+            barrera.esperar();
+
+            rangos.swap(nuevos);
+            contribucion.swap(contribucionNueva);
+            resultado.error = 0.0;
+            colgante = 0.0;
+            for (const Parcial& parcial : parciales) {
+                resultado.error += parcial.error;
+                colgante += parcial.colgante;
+            }
+            resultado.iteraciones++;
+            if (resultado.error < opciones.tolerancia) {
+                resultado.convergio = true;
+                break;
+            }
+        }
+        terminar = true;
+        barrera.esperar();
+        for (std::thread& trabajador : trabajadores) {
+            trabajador.join();
+        }
+        resultado.rangos = std::move(rangos);
+        return resultado;
+    }
+
+public:
+    /**
+     * @param grafo Grafo dirigido o no dirigido; en uno no dirigido cada arista cuenta en las dos direcciones.
+     */
+    explicit CalculadoraPageRank(const GrafoCsr& grafo)
+        : entrantes(grafo.esDirigido() ? grafo.transpuesta() : grafo), inversoGrado(grafo.numeroVertices()) {
+        for (std::size_t v = 0; v < grafo.numeroVertices(); ++v) {
+            std::size_t grado = grafo.grado(static_cast<IdVertice>(v));
+            inversoGrado[v] = grado == 0 ? 0.0 : 1.0 / static_cast<double>(grado);
+        }
+    }
+
+    /**
+     * @brief PageRank clásico: al saltar, cualquier vértice es igual de probable.
+     */
+    ResultadoPageRank calcular(const OpcionesPageRank& opciones = OpcionesPageRank()) const {
+        return iterar({}, opciones);
+    }
+
+    /**
+     * @brief PageRank personalizado: al saltar, se elige un vértice con probabilidad proporcional a su preferencia.
+     * @param preferencias Peso no negativo de cada vértice (por ejemplo 1 en los vértices semilla y 0 en el resto).
+     * @throws std::invalid_argument Si el tamaño no coincide, hay pesos negativos o todos son cero.
+     */
+    ResultadoPageRank calcularPersonalizado(const std::vector<double>& preferencias,
+                                            const OpcionesPageRank& opciones = OpcionesPageRank()) const {
+        if (preferencias.size() != entrantes.numeroVertices()) {
+            throw std::invalid_argument("Se necesita una preferencia por vértice.");
+        }
+        double total = 0.0;
+        for (double p : preferencias) {
+            if (p < 0.0) {
+                throw std::invalid_argument("Las preferencias no pueden ser negativas.");
+            }
+            total += p;
+        }
+        if (total <= 0.0) {
+            throw std::invalid_argument("Al menos una preferencia debe ser positiva.");
+        }
+        std::vector<double> salto(preferencias.size());
+        for (std::size_t v = 0; v < salto.size(); ++v) {
+            salto[v] = preferencias[v] / total;
+        }
+        return iterar(salto, opciones);
+    }
+};
+
+/**
+ * @brief PageRank de un grafo; para varios cálculos sobre el mismo grafo conviene reutilizar una CalculadoraPageRank.
+ */
+inline ResultadoPageRank pageRank(const GrafoCsr& grafo, const OpcionesPageRank& opciones = OpcionesPageRank()) {
+    return CalculadoraPageRank(grafo).calcular(opciones);
+}
+
+/**
+ * @brief PageRank personalizado de un grafo según las preferencias de salto de cada vértice.
+ */
+inline ResultadoPageRank pageRankPersonalizado(const GrafoCsr& grafo, const std::vector<double>& preferencias,
+                                               const OpcionesPageRank& opciones = OpcionesPageRank()) {
+    return CalculadoraPageRank(grafo).calcularPersonalizado(preferencias, opciones);
+}
+
+/**
+ * @brief Distribución de los grados de un grafo.
+ */
+struct EstadisticasGrado {
+    std::size_t minimo = 0;
+    std::size_t maximo = 0;
+    double promedio = 0.0;
+    double desviacion = 0.0;          ///< Desviación estándar.
+    std::size_t mediana = 0;
+    std::size_t percentil99 = 0;
+    std::size_t aislados = 0;         ///< Vértices sin ninguna arista, ni de salida ni de entrada.
+    std::vector<std::size_t> histograma; ///< histograma[g] = número de vértices de grado g, para g de 0 a maximo.
+};
+
+/**
+ * @brief Calcula la distribución de los grados de salida o de entrada.
+ * @param grafo Instantánea del grafo.
+ * @param deEntrada Si es true se usan los grados de entrada (en un grafo no dirigido coinciden con los de salida).
+ * Los grados se cuentan en un arreglo denso y las estadísticas de orden salen del histograma, sin ordenar. O(n + m).
+ */
+inline EstadisticasGrado estadisticasGrado(const GrafoCsr& grafo, bool deEntrada = false) {
+    const std::size_t n = grafo.numeroVertices();
+    EstadisticasGrado estadisticas;
+    if (n == 0) {
+        return estadisticas;
+    }
+    // En un grafo dirigido hacen falta los grados de entrada también para contar los aislados
+    std::vector<std::size_t> gradosEntrada;
+    if (grafo.esDirigido()) {
+        gradosEntrada.assign(n, 0);
+        for (IdVertice w : grafo.obtenerDestinos()) {
+            gradosEntrada[w]++;
+        }
+    }
+    std::vector<std::size_t> grados(n, 0);
+    for (std::size_t v = 0; v < n; ++v) {
+        grados[v] = deEntrada && grafo.esDirigido() ? gradosEntrada[v] : grafo.grado(static_cast<IdVertice>(v));
+    }
+
+    estadisticas.minimo = *std::min_element(grados.begin(), grados.end());
+    estadisticas.maximo = *std::max_element(grados.begin(), grados.end());
+    estadisticas.histograma.assign(estadisticas.maximo + 1, 0);
+    double suma = 0.0, sumaCuadrados = 0.0;
+    for (std::size_t g : grados) {
+        estadisticas.histograma[g]++;
+        suma += static_cast<double>(g);
+        sumaCuadrados += static_cast<double>(g) * static_cast<double>(g);
+    }
+    estadisticas.promedio = suma / static_cast<double>(n);
+    estadisticas.desviacion = std::sqrt(std::max(0.0, sumaCuadrados / static_cast<double>(n)
+                                                     - estadisticas.promedio * estadisticas.promedio));
+    if (grafo.esDirigido()) {
+        for (std::size_t v = 0; v < n; ++v) {
+            estadisticas.aislados += grafo.grado(static_cast<IdVertice>(v)) == 0 && gradosEntrada[v] == 0 ? 1 : 0;
+        }
+    } else {
+        estadisticas.aislados = estadisticas.histograma[0];
+    }
+
+    // Percentiles recorriendo el histograma acumulado
+    auto percentil = [&](double fraccion) {
+        std::size_t posicion = static_cast<std::size_t>(fraccion * static_cast<double>(n - 1));
+        std::size_t acumulado = 0;
+        for (std::size_t g = 0; g < estadisticas.histograma.size(); ++g) {
+            acumulado += estadisticas.histograma[g];
+            if (acumulado > posicion) {
+                return g;
+            }
+        }
+        return estadisticas.maximo;
+    };
+    estadisticas.mediana = percentil(0.5);
+    estadisticas.percentil99 = percentil(0.99);
+    return estadisticas;
+}
+
+#endif
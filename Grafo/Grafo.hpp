@@ -1,32 +1,69 @@
 /**
  * @file Grafo.hpp
  * @brief Declaracion de la clase Grafo
- * @details Esta clase representa un grafo no dirigido, que contiene una lista de vertices.
+ * @details Esta clase representa un grafo, no dirigido por defecto o dirigido si se pide al construirlo,
+ * que contiene una lista de vertices.
  * Esta clase es un contenedor para los vertices y permite operaciones sobre el grafo.
+ * Para los algoritmos (Algoritmos.hpp) se toma una instantánea contigua con instantanea().
+ * Para mejorar la localidad de los recorridos se pueden renumerar los vertices con reordenar() (Reordenamiento.hpp).
  */
 #ifndef GRAFO_HPP
 #define GRAFO_HPP
 #include <vector>
 #include "Vertice.hpp"
+#include "GrafoCsr.hpp"
+#include "Reordenamiento.hpp"
+#include "../Instrumentacion/Instrumentacion.hpp"
 #include <iostream>
 #include <queue>
+#include <unordered_map>
 #include <unordered_set>
 #include <memory>
 #include <algorithm>
-template<typename T>
+
+/**
+ * @tparam Instrumentacion Política de instrumentación; por defecto no mide nada.
+ */
+template<typename T, typename Instrumentacion = SinInstrumentacion>
 class Grafo {
 private:
 
     // Vector de punteros inteligentes a Vertice, para manejar la memoria automáticamente
     std::vector<std::unique_ptr<Vertice<T>>> vertices;
+    // Si es dirigido, agregarArista sólo enlaza el origen con el destino
+    bool dirigido;
 
 public:
+    /**
+     * @brief Constructor del grafo
+     * @param dirigido Si es true, cada arista va sólo del origen al destino; si no, en ambas direcciones.
+     */
+    explicit Grafo(bool dirigido = false) : dirigido(dirigido) {}
+
+    bool esDirigido() const {
+        return dirigido;
+    }
+
+    std::size_t numeroVertices() const {
+        return vertices.size();
+    }
+
+    /**
+     * @brief Devuelve el valor del vertice con un id denso, es decir, su posición en el grafo
+     * Sirve para traducir los resultados de los algoritmos, que se indexan por id.
+     */
+    const T& valorEn(IdVertice id) const {
+        return vertices[id]->valor;
+    }
+
     /**
      * @brief Agrega un vertice al grafo
      * @param valor El valor del vertice a agregar
      * Agrega a la lista la dirección de memoria del nuevo vertice que almacena un valor y una lista de adyacentes.
      */
     void agregarVertice(T valor) {
+        typename Instrumentacion::Temporizador medir("grafo_agregar_vertice");
+        Instrumentacion::asignacion();
         vertices.push_back(std::make_unique<Vertice<T>>(valor));
     }
 
@@ -37,6 +74,8 @@ public:
      */
     Vertice<T>* encontrarVertice(T valor) {
         for (const auto& v : vertices) {
+            Instrumentacion::salto();
+            Instrumentacion::comparacion();
             if (v->valor == valor)
                 return v.get();
         }
@@ -48,14 +87,18 @@ public:
      * @param origen El valor del vertice de origen
      * @param destino El valor del vertice de destino
      * Agrega una arista entre los vertices de origen y destino, si ambos existen.
+     * En un grafo no dirigido también agrega la arista de vuelta.
      */
     void agregarArista(T origen, T destino) {
+        typename Instrumentacion::Temporizador medir("grafo_agregar_arista");
         Vertice<T>* vOrigen = encontrarVertice(origen);
         Vertice<T>* vDestino = encontrarVertice(destino);
 
         if (vOrigen && vDestino) {
             vOrigen->adyacentes.push_back(vDestino);
-            vDestino->adyacentes.push_back(vOrigen); // porque es no dirigido
+            if (!dirigido) {
+                vDestino->adyacentes.push_back(vOrigen);
+            }
         }
     }
 
@@ -77,6 +120,7 @@ public:
      * @param origen El valor del vertice de origen
      * @param destino El valor del vertice de destino
      * Elimina la arista entre los vertices de origen y destino, si ambos existen.
+     * En un grafo no dirigido también elimina la arista de vuelta.
      */
     void eliminarArista(T origen, T destino) {
         Vertice<T>* vOrigen = encontrarVertice(origen);
@@ -85,7 +129,67 @@ public:
         if (vOrigen && vDestino) {
             auto& adyacentesOrigen = vOrigen->adyacentes;
             adyacentesOrigen.erase(std::remove(adyacentesOrigen.begin(), adyacentesOrigen.end(), vDestino), adyacentesOrigen.end());
+            if (!dirigido) {
+                auto& adyacentesDestino = vDestino->adyacentes;
+                adyacentesDestino.erase(std::remove(adyacentesDestino.begin(), adyacentesDestino.end(), vOrigen), adyacentesDestino.end());
+            }
+        }
+    }
+
+    /**
+     * @brief Toma una instantánea contigua del grafo
+     * @return GrafoCsr en el que el id de cada vertice es su posición en el grafo (ver valorEn()).
+     * Las listas de adyacencia se copian tal cual, en el mismo orden. O(n + m).
+     */
+    GrafoCsr instantanea() const {
+        typename Instrumentacion::Temporizador medir("grafo_instantanea");
+        std::unordered_map<const Vertice<T>*, IdVertice> ids;
+        ids.reserve(vertices.size());
+        std::vector<std::size_t> desplazamientos(vertices.size() + 1, 0);
+        for (std::size_t i = 0; i < vertices.size(); ++i) {
+            ids.emplace(vertices[i].get(), static_cast<IdVertice>(i));
+            desplazamientos[i + 1] = desplazamientos[i] + vertices[i]->adyacentes.size();
+        }
+        std::vector<IdVertice> destinos;
+        destinos.reserve(desplazamientos.back());
+        for (const auto& v : vertices) {
+            for (const Vertice<T>* vecino : v->adyacentes) {
+                destinos.push_back(ids.find(vecino)->second);
+            }
+        }
+        return GrafoCsr(std::move(desplazamientos), std::move(destinos), dirigido);
+    }
+
+    /**
+     * @brief Renumera los vertices para que los vecinos queden cerca en memoria
+     * @param criterio Criterio de orden; por defecto Cuthill-McKee inverso.
+     * @return Permutación aplicada: aNuevo(id) traduce un id de antes de reordenar a su nueva posición
+     * y aViejo(id) hace lo contrario, así que los resultados calculados antes se pueden seguir usando.
+     * Los vertices se vuelven a crear en el nuevo orden, para que también sus direcciones queden juntas, y las
+     * listas de adyacencia quedan ordenadas por la nueva posición. Invalida los punteros a Vertice obtenidos antes
+     * con encontrarVertice(). O(n + m log Δ).
+     */
+    Permutacion reordenar(CriterioOrden criterio = CriterioOrden::CuthillMcKeeInverso) {
+        typename Instrumentacion::Temporizador medir("grafo_reordenar");
+        GrafoCsr actual = instantanea();
+        Permutacion permutacion = calcularPermutacion(actual, criterio);
+
+        std::vector<std::unique_ptr<Vertice<T>>> reordenados;
+        reordenados.reserve(vertices.size());
+        for (IdVertice viejo : permutacion.nuevoAViejo) {
+            Instrumentacion::asignacion();
+            reordenados.push_back(std::make_unique<Vertice<T>>(std::move(vertices[viejo]->valor)));
+        }
+        GrafoCsr permutado = permutar(actual, permutacion);
+        for (std::size_t i = 0; i < reordenados.size(); ++i) {
+            auto& adyacentes = reordenados[i]->adyacentes;
+            adyacentes.reserve(permutado.grado(static_cast<IdVertice>(i)));
+            for (IdVertice w : permutado.vecinos(static_cast<IdVertice>(i))) {
+                adyacentes.push_back(reordenados[w].get());
+            }
         }
+        vertices = std::move(reordenados);
+        return permutacion;
     }
 
     /**
@@ -96,6 +200,7 @@ public:
      * Si el vertice no existe, no hace nada.
      */
     void eliminarVertice(T valor) {
+        typename Instrumentacion::Temporizador medir("grafo_eliminar_vertice");
         // Buscar el vértice a eliminar
         typename std::vector<std::unique_ptr<Vertice<T>>>::iterator it = vertices.begin();
         Vertice<T>* verticeAEliminar = nullptr;
@@ -133,6 +238,7 @@ public:
      * Realiza una búsqueda en anchura e imprime los valores de los vértices visitados.
      */
     void BFS(T inicio) {
+        typename Instrumentacion::Temporizador medir("grafo_bfs");
         Vertice<T>* verticeInicio = encontrarVertice(inicio);
         if (!verticeInicio) {
             std::cout << "Vértice no encontrado.\n";
@@ -151,6 +257,7 @@ public:
             std::cout << actual->valor << " ";
 
             for (Vertice<T>* vecino : actual->adyacentes) {
+                Instrumentacion::salto();
                 if (visitados.find(vecino) == visitados.end()) {
                     cola.push(vecino);
                     visitados.insert(vecino);
@@ -161,6 +268,7 @@ public:
     }
 
     void DFS(T inicio) {
+        typename Instrumentacion::Temporizador medir("grafo_dfs");
         Vertice<T>* verticeInicio = encontrarVertice(inicio);
         if (!verticeInicio) {
             std::cout << "Vértice no encontrado.\n";
@@ -179,6 +287,7 @@ public:
         visitados.insert(actual);
 
         for (Vertice<T>* vecino : actual->adyacentes) {
+            Instrumentacion::salto();
             DFSRecursivo(vecino, visitados);
         }
     }
@@ -0,0 +1,137 @@
+/**
+ * @file GrafoCsr.hpp
+ * @brief Declaracion de la clase GrafoCsr, una instantánea contigua de un grafo.
+ * @details Los vértices se identifican con enteros densos de 0 a n - 1 y las listas de adyacencia se guardan una tras otra
+ * en un solo arreglo (formato CSR, compressed sparse row). Recorrer los vecinos de un vértice es leer memoria contigua,
+ * y los algoritmos pueden guardar sus resultados en arreglos indexados por vértice en lugar de tablas hash.
+ */
+#ifndef GRAFOCSR_HPP
+#define GRAFOCSR_HPP
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+/// Identificador denso de un vértice dentro de una instantánea.
+using IdVertice = std::uint32_t;
+
+/**
+ * @brief Rango de los vecinos de un vértice; apunta dentro de la instantánea, no copia nada.
+ */
+class Vecinos {
+private:
+    const IdVertice* inicio;
+    const IdVertice* fin;
+
+public:
+    Vecinos(const IdVertice* inicio, const IdVertice* fin) : inicio(inicio), fin(fin) {}
+
+    const IdVertice* begin() const { return inicio; }
+    const IdVertice* end() const { return fin; }
+    std::size_t tamano() const { return static_cast<std::size_t>(fin - inicio); }
+    IdVertice operator[](std::size_t i) const { return inicio[i]; }
+};
+
+/**
+ * @class GrafoCsr
+ * @brief Grafo inmutable en formato CSR. Se obtiene con Grafo::instantanea() o se arma desde una lista de aristas.
+ */
+class GrafoCsr {
+private:
+    std::vector<std::size_t> desplazamientos; ///< Los vecinos de v ocupan [desplazamientos[v], desplazamientos[v + 1]).
+    std::vector<IdVertice> destinos;          ///< Listas de adyacencia de todos los vértices, una tras otra.
+    bool dirigido = false;
+
+public:
+    GrafoCsr() : desplazamientos(1, 0) {}
+
+    /**
+     * @brief Crea la instantánea a partir de arreglos ya armados.
+     * @param desplazamientos n + 1 posiciones crecientes, empezando en 0 y terminando en destinos.size().
+     * @param destinos Vecinos de todos los vértices.
+     * @param dirigido Si es false, cada arista debe aparecer en las dos direcciones.
+     */
+    GrafoCsr(std::vector<std::size_t> desplazamientos, std::vector<IdVertice> destinos, bool dirigido)
+        : desplazamientos(std::move(desplazamientos)), destinos(std::move(destinos)), dirigido(dirigido) {
+        if (this->desplazamientos.empty() || this->desplazamientos.front() != 0 ||
+            this->desplazamientos.back() != this->destinos.size()) {
+            throw std::invalid_argument("Desplazamientos de GrafoCsr inconsistentes con los destinos.");
+        }
+    }
+
+    /**
+     * @brief Crea la instantánea a partir de una lista de aristas, con un ordenamiento por conteo en O(n + m).
+     * @param numeroVertices Número de vértices; las aristas deben usar ids menores.
+     * @param aristas Pares (origen, destino).
+     * @param dirigido Si es false, cada arista se guarda en las dos direcciones.
+     * El orden de los vecinos de cada vértice es el orden en que aparecen sus aristas.
+     */
+    static GrafoCsr desdeAristas(std::size_t numeroVertices, const std::vector<std::pair<IdVertice, IdVertice>>& aristas,
+                                 bool dirigido) {
+        std::vector<std::size_t> desplazamientos(numeroVertices + 1, 0);
+        for (const auto& arista : aristas) {
+            if (arista.first >= numeroVertices || arista.second >= numeroVertices) {
+                throw std::out_of_range("Arista con un vértice fuera de rango.");
+            }
+            desplazamientos[arista.first + 1]++;
+            if (!dirigido) {
+                desplazamientos[arista.second + 1]++;
+            }
+        }
+        for (std::size_t v = 0; v < numeroVertices; ++v) {
+            desplazamientos[v + 1] += desplazamientos[v];
+        }
+        std::vector<IdVertice> destinos(desplazamientos.back());
+        std::vector<std::size_t> siguiente(desplazamientos.begin(), desplazamientos.end() - 1);
+        for (const auto& arista : aristas) {
+            destinos[siguiente[arista.first]++] = arista.second;
+            if (!dirigido) {
+                destinos[siguiente[arista.second]++] = arista.first;
+            }
+        }
+        return GrafoCsr(std::move(desplazamientos), std::move(destinos), dirigido);
+    }
+
+    std::size_t numeroVertices() const { return desplazamientos.size() - 1; }
+
+    /// Número de aristas guardadas; en un grafo no dirigido cada arista cuenta dos veces.
+    std::size_t numeroAristas() const { return destinos.size(); }
+
+    bool esDirigido() const { return dirigido; }
+
+    Vecinos vecinos(IdVertice v) const {
+        return Vecinos(destinos.data() + desplazamientos[v], destinos.data() + desplazamientos[v + 1]);
+    }
+
+    std::size_t grado(IdVertice v) const { return desplazamientos[v + 1] - desplazamientos[v]; }
+
+    const std::vector<std::size_t>& obtenerDesplazamientos() const { return desplazamientos; }
+    const std::vector<IdVertice>& obtenerDestinos() const { return destinos; }
+
+    /**
+     * @brief Devuelve el grafo con todas las aristas invertidas: los vecinos de v pasan a ser sus predecesores.
+     * En un grafo no dirigido es una copia.
+     */
+    GrafoCsr transpuesta() const {
+        const std::size_t n = numeroVertices();
+        std::vector<std::size_t> nuevosDesplazamientos(n + 1, 0);
+        for (IdVertice w : destinos) {
+            nuevosDesplazamientos[w + 1]++;
+        }
+        for (std::size_t v = 0; v < n; ++v) {
+            nuevosDesplazamientos[v + 1] += nuevosDesplazamientos[v];
+        }
+        std::vector<IdVertice> nuevosDestinos(destinos.size());
+        std::vector<std::size_t> siguiente(nuevosDesplazamientos.begin(), nuevosDesplazamientos.end() - 1);
+        // Recorrer los orígenes en orden deja los predecesores de cada vértice ordenados
+        for (std::size_t v = 0; v < n; ++v) {
+            for (std::size_t i = desplazamientos[v]; i < desplazamientos[v + 1]; ++i) {
+                nuevosDestinos[siguiente[destinos[i]]++] = static_cast<IdVertice>(v);
+            }
+        }
+        return GrafoCsr(std::move(nuevosDesplazamientos), std::move(nuevosDestinos), dirigido);
+    }
+};
+
+#endif
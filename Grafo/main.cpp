@@ -4,7 +4,12 @@
  * @details Este archivo contiene el punto de entrada del programa y ejemplos de uso de la clase Grafo.
  */
 #include "Grafo.hpp"
+#include "Algoritmos.hpp"
+#include "Centralidad.hpp"
+#include "Reordenamiento.hpp"
 #include <iostream>
+#include <string>
+#include <vector>
 
 int main() {
     Grafo<int> grafo;
@@ -52,5 +57,131 @@ int main() {
     std::cout << "DFS desde el vértice 1: ";
     grafo.DFS(1);
 
+    // Un grafo dirigido de dependencias: cada arista va de una tarea a otra que depende de ella
+    Grafo<std::string> tareas(true);
+    for (const char* nombre : {"configurar", "compilar", "probar", "empaquetar", "publicar", "documentar"}) {
+        tareas.agregarVertice(nombre);
+    }
+    tareas.agregarArista("configurar", "compilar");
+    tareas.agregarArista("compilar", "probar");
+    tareas.agregarArista("compilar", "documentar");
+    tareas.agregarArista("probar", "empaquetar");
+    tareas.agregarArista("empaquetar", "publicar");
+
+    GrafoCsr dependencias = tareas.instantanea();
+    OrdenTopologico orden = ordenTopologico(dependencias);
+    std::cout << "Orden de las tareas:";
+    for (IdVertice id : orden.orden) {
+        std::cout << " " << tareas.valorEn(id);
+    }
+    std::cout << (orden.esAciclico ? "" : " (hay un ciclo)") << "\n";
+
+    // Una dependencia circular
+    tareas.agregarArista("publicar", "probar");
+    dependencias = tareas.instantanea();
+    std::cout << "¿Acíclico tras agregar publicar -> probar? " << (ordenTopologico(dependencias).esAciclico ? "sí" : "no") << "\n";
+    std::cout << "Ciclo:";
+    for (IdVertice id : buscarCiclo(dependencias)) {
+        std::cout << " " << tareas.valorEn(id);
+    }
+    std::cout << "\n";
+
+    ComponentesFuertes componentes = componentesFuertes(dependencias);
+    std::cout << "Componentes fuertemente conexas: " << componentes.cantidad << "\n";
+    for (IdVertice id = 0; id < dependencias.numeroVertices(); ++id) {
+        std::cout << "  " << tareas.valorEn(id) << " -> componente " << componentes.componente[id] << "\n";
+    }
+
+    // Bipartición: un ciclo par es bipartito, uno impar no
+    Grafo<int> anillo;
+    for (int i = 0; i < 6; ++i) anillo.agregarVertice(i);
+    for (int i = 0; i < 6; ++i) anillo.agregarArista(i, (i + 1) % 6);
+    Biparticion lados = biparticion(anillo.instantanea());
+    std::cout << "Anillo de 6: " << (lados.esBipartito ? "bipartito, lados" : "no bipartito");
+    for (std::uint8_t lado : lados.lado) {
+        std::cout << " " << static_cast<int>(lado);
+    }
+    std::cout << "\n";
+    anillo.agregarArista(0, 2);
+    std::cout << "Con la cuerda 0-2: " << (biparticion(anillo.instantanea()).esBipartito ? "bipartito" : "no bipartito") << "\n";
+
+    // PageRank de una pequeña red de enlaces: "inicio" recibe enlaces de todas las páginas
+    Grafo<std::string> web(true);
+    for (const char* pagina : {"inicio", "blog", "contacto", "tienda", "ayuda"}) {
+        web.agregarVertice(pagina);
+    }
+    web.agregarArista("blog", "inicio");
+    web.agregarArista("contacto", "inicio");
+    web.agregarArista("tienda", "inicio");
+    web.agregarArista("ayuda", "inicio");
+    web.agregarArista("inicio", "blog");
+    web.agregarArista("inicio", "tienda");
+    web.agregarArista("tienda", "ayuda");
+
+    GrafoCsr enlaces = web.instantanea();
+    CalculadoraPageRank calculadora(enlaces);
+    ResultadoPageRank rangos = calculadora.calcular();
+    std::cout << "PageRank (" << rangos.iteraciones << " iteraciones, error " << rangos.error << "):\n";
+    for (IdVertice id = 0; id < enlaces.numeroVertices(); ++id) {
+        std::cout << "  " << web.valorEn(id) << ": " << rangos.rangos[id] << "\n";
+    }
+
+    // Personalizado: los saltos siempre caen en "ayuda"
+    std::vector<double> preferencias(enlaces.numeroVertices(), 0.0);
+    preferencias[4] = 1.0;
+    ResultadoPageRank cercania = calculadora.calcularPersonalizado(preferencias);
+    std::cout << "PageRank personalizado hacia ayuda:";
+    for (IdVertice id = 0; id < enlaces.numeroVertices(); ++id) {
+        std::cout << " " << web.valorEn(id) << "=" << cercania.rangos[id];
+    }
+    std::cout << "\n";
+
+    EstadisticasGrado salida = estadisticasGrado(enlaces);
+    EstadisticasGrado entrada = estadisticasGrado(enlaces, true);
+    std::cout << "Grado de salida: mínimo " << salida.minimo << ", máximo " << salida.maximo << ", promedio " << salida.promedio
+              << ", mediana " << salida.mediana << "\n";
+    std::cout << "Grado de entrada: mínimo " << entrada.minimo << ", máximo " << entrada.maximo
+              << ", aislados " << entrada.aislados << ", histograma";
+    for (std::size_t cantidad : entrada.histograma) {
+        std::cout << " " << cantidad;
+    }
+    std::cout << "\n";
+
+    // Reordenamiento: una malla de 4 x 4 cuyas celdas se agregan salteadas, así que los vecinos quedan lejos
+    Grafo<int> malla;
+    const int LADO = 4;
+    for (int i = 0; i < LADO * LADO; ++i) {
+        malla.agregarVertice((i * 7) % (LADO * LADO)); // 7 es coprimo con 16: recorre todas las celdas
+    }
+    for (int celda = 0; celda < LADO * LADO; ++celda) {
+        if (celda % LADO + 1 < LADO) malla.agregarArista(celda, celda + 1);
+        if (celda + LADO < LADO * LADO) malla.agregarArista(celda, celda + LADO);
+    }
+    Localidad antes = medirLocalidad(malla.instantanea());
+    std::cout << "Malla en orden de inserción: ancho de banda " << antes.anchoDeBanda << ", distancia promedio "
+              << antes.distanciaPromedio << "\n";
+    GrafoCsr celdas = malla.instantanea();
+    const std::pair<CriterioOrden, const char*> criterios[] = {
+        {CriterioOrden::CuthillMcKeeInverso, "Cuthill-McKee inverso"},
+        {CriterioOrden::PorGrado, "por grado"},
+        {CriterioOrden::PorAnchura, "por anchura"}};
+    for (const auto& [criterio, nombre] : criterios) {
+        Localidad despues = medirLocalidad(permutar(celdas, calcularPermutacion(celdas, criterio)));
+        std::cout << "  " << nombre << ": ancho de banda " << despues.anchoDeBanda << ", distancia promedio "
+                  << despues.distanciaPromedio << "\n";
+    }
+
+    // Reordenar el propio grafo; la permutación traduce los ids de antes a los de ahora
+    IdVertice idAntes = 0;
+    while (malla.valorEn(idAntes) != 5) ++idAntes;
+    Permutacion permutacion = malla.reordenar();
+    std::cout << "Celda 5: id " << idAntes << " antes de reordenar, " << permutacion.aNuevo(idAntes) << " después ("
+              << malla.valorEn(permutacion.aNuevo(idAntes)) << ")\n";
+    std::cout << "Orden nuevo de las celdas:";
+    for (IdVertice id = 0; id < malla.numeroVertices(); ++id) {
+        std::cout << " " << malla.valorEn(id);
+    }
+    std::cout << "\n";
+
     return 0;
 }
\ No newline at end of file
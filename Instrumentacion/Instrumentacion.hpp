@@ -0,0 +1,137 @@
+/**
+ * @file Instrumentacion.hpp
+ * @brief Políticas de instrumentación para los contenedores: SinInstrumentacion y ConInstrumentacion.
+ * Cada contenedor recibe la política como parámetro de plantilla y llama a sus funciones estáticas en los puntos
+ * de interés: al reservar un nodo, al comparar dos valores y al seguir un puntero. Con SinInstrumentacion, la
+ * política por defecto, esas funciones están vacías y el compilador las elimina, así que no cuestan nada.
+ * Con ConInstrumentacion se cuentan en variables por hilo y cada operación pública, medida con un Temporizador,
+ * deja un RegistroOperacion en un buffer circular por hilo con su duración y lo que contó.
+ */
+#ifndef INSTRUMENTACION_HPP
+#define INSTRUMENTACION_HPP
+
+#include "../ListaSimplementeEnlazadaCircular/BufferCircular.hpp"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Eventos contados durante una operación.
+ */
+struct ContadoresOperacion {
+    std::uint64_t asignaciones = 0;  ///< Nodos reservados.
+    std::uint64_t comparaciones = 0; ///< Comparaciones entre valores almacenados.
+    std::uint64_t saltos = 0;        ///< Punteros seguidos de un nodo a otro.
+};
+
+/**
+ * @brief Resultado de una operación medida con un Temporizador.
+ */
+struct RegistroOperacion {
+    const char* operacion = "";      ///< Nombre de la operación, por ejemplo "lista_buscar".
+    std::uint64_t nanosegundos = 0;  ///< Duración de la operación.
+    ContadoresOperacion contadores;  ///< Eventos contados mientras duró.
+};
+
+/**
+ * @struct SinInstrumentacion
+ * @brief Política por defecto: todas las funciones están vacías y no dejan rastro en el código generado.
+ */
+struct SinInstrumentacion {
+    static constexpr bool activa = false;
+
+    static void asignacion() {}
+    static void comparacion() {}
+    static void salto() {}
+
+    /**
+     * @brief Temporizador vacío; construirlo no hace nada.
+     */
+    struct Temporizador {
+        explicit Temporizador(const char*) {}
+    };
+};
+
+/**
+ * @struct ConInstrumentacion
+ * @brief Política que cuenta eventos y mide operaciones, sin candados ni atómicos: todo el estado es por hilo.
+ * Cada hilo guarda sus últimas CAPACIDAD operaciones; al llenarse, las nuevas sobrescriben a las más antiguas.
+ */
+struct ConInstrumentacion {
+    static constexpr bool activa = true;
+    static constexpr std::size_t CAPACIDAD = 1024;
+
+    using Buffer = BufferCircular<RegistroOperacion, CAPACIDAD>;
+
+    /**
+     * @brief Contadores acumulados por el hilo actual desde que empezó.
+     */
+    static ContadoresOperacion& contadores() {
+        thread_local ContadoresOperacion propios;
+        return propios;
+    }
+
+    /**
+     * @brief Últimas operaciones medidas en el hilo actual, de la más antigua a la más nueva.
+     */
+    static Buffer& registros() {
+        thread_local Buffer propios;
+        return propios;
+    }
+
+    static void asignacion() { contadores().asignaciones++; }
+    static void comparacion() { contadores().comparaciones++; }
+    static void salto() { contadores().saltos++; }
+
+    /**
+     * @class Temporizador
+     * @brief Mide el bloque en que vive: al destruirse guarda la duración y los eventos contados desde su creación.
+     * Los temporizadores anidados funcionan; los eventos de la operación interna cuentan también para la externa.
+     */
+    class Temporizador {
+    private:
+        const char* operacion;
+        ContadoresOperacion inicio;
+        std::chrono::steady_clock::time_point comienzo;
+
+    public:
+        explicit Temporizador(const char* nombre)
+            : operacion(nombre), inicio(contadores()), comienzo(std::chrono::steady_clock::now()) {}
+
+        Temporizador(const Temporizador&) = delete;
+        Temporizador& operator=(const Temporizador&) = delete;
+
+        ~Temporizador() {
+            auto duracion = std::chrono::steady_clock::now() - comienzo;
+            const ContadoresOperacion& ahora = contadores();
+            RegistroOperacion registro;
+            registro.operacion = operacion;
+            registro.nanosegundos = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duracion).count());
+            registro.contadores.asignaciones = ahora.asignaciones - inicio.asignaciones;
+            registro.contadores.comparaciones = ahora.comparaciones - inicio.comparaciones;
+            registro.contadores.saltos = ahora.saltos - inicio.saltos;
+            registros().insertar(registro);
+        }
+    };
+
+    /**
+     * @brief Pasa las operaciones guardadas por el hilo actual a un registro de métricas y vacía el buffer.
+     * @param registro Un RegistroMetricas (Contador/Metricas.h); por cada operación se llenan el histograma
+     * "<operacion>_ns" y los contadores "<operacion>_asignaciones_total", "_comparaciones_total" y "_saltos_total".
+     * Es plantilla para que los contenedores no dependan de Metricas.h si no se exporta nada.
+     */
+    template <typename Registro>
+    static void volcar(Registro& registro) {
+        for (const RegistroOperacion& r : registros()) {
+            std::string nombre = r.operacion;
+            registro.histograma(nombre + "_ns", "Duración de " + nombre + " en nanosegundos.").registrar(r.nanosegundos);
+            registro.contador(nombre + "_asignaciones_total", "Nodos reservados por " + nombre + ".").incrementar(r.contadores.asignaciones);
+            registro.contador(nombre + "_comparaciones_total", "Comparaciones hechas por " + nombre + ".").incrementar(r.contadores.comparaciones);
+            registro.contador(nombre + "_saltos_total", "Punteros seguidos por " + nombre + ".").incrementar(r.contadores.saltos);
+        }
+        registros().limpiar();
+    }
+};
+
+#endif
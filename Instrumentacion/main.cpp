@@ -0,0 +1,51 @@
+/**
+ * @file main.cpp
+ * @brief Programa de ejemplo de las políticas de instrumentación.
+ * Usa una Lista y un Grafo con ConInstrumentacion, muestra lo que midió cada operación
+ * y lo vuelca en un RegistroMetricas exportado en formato Prometheus.
+ */
+#include "Instrumentacion.hpp"
+#include "../ListaEnlazada/Lista.hpp"
+#include "../Grafo/Grafo.hpp"
+#include "../Contador/Metricas.h"
+#include <iostream>
+
+int main() {
+    Lista<int, ConInstrumentacion> lista;
+    for (int i = 0; i < 100; ++i) {
+        lista.insertarAlFinal(i);
+    }
+    lista.buscar(75);
+
+    Grafo<int, ConInstrumentacion> grafo;
+    for (int i = 1; i <= 4; ++i) {
+        grafo.agregarVertice(i);
+    }
+    grafo.agregarArista(1, 2);
+    grafo.agregarArista(2, 3);
+    grafo.agregarArista(3, 4);
+    std::cout << "BFS desde 1: ";
+    grafo.BFS(1);
+
+    // Las últimas operaciones del hilo, con su duración y lo que contaron
+    const ConInstrumentacion::Buffer& registros = ConInstrumentacion::registros();
+    for (std::size_t i = registros.tamano() - 4; i < registros.tamano(); ++i) {
+        const RegistroOperacion& r = registros[i];
+        std::cout << r.operacion << ": " << r.nanosegundos << " ns, "
+                  << r.contadores.asignaciones << " asignaciones, "
+                  << r.contadores.comparaciones << " comparaciones, "
+                  << r.contadores.saltos << " saltos\n";
+    }
+
+    RegistroMetricas metricas;
+    ConInstrumentacion::volcar(metricas);
+    std::cout << "Métricas registradas: " << metricas.tamano() << "\n";
+    std::cout << metricas.exportarPrometheus().substr(0, 300) << "...\n";
+
+    // Con la política por defecto las mismas llamadas no dejan rastro
+    Lista<int> sinMedir;
+    sinMedir.insertarAlFinal(1);
+    std::cout << "Operaciones pendientes tras volcar: " << ConInstrumentacion::registros().tamano() << "\n";
+
+    return 0;
+}
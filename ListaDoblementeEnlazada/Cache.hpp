@@ -0,0 +1,366 @@
+/**
+ * @file Cache.hpp
+ * @brief Definición de las clases CacheLRU y CacheLFU.
+ * Ambas combinan ListaDoble, que mantiene el orden de uso y permite mover o quitar un nodo en O(1)
+ * a partir de su iterador, con un índice hash que lleva de cada clave a su iterador.
+ */
+#ifndef CACHE_HPP
+#define CACHE_HPP
+
+#include "listaDoble.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+/**
+ * @brief Contadores de actividad de una caché.
+ */
+struct EstadisticasCache {
+    std::uint64_t aciertos = 0;   ///< Llamadas a obtener() que encontraron la clave.
+    std::uint64_t fallos = 0;     ///< Llamadas a obtener() que no la encontraron.
+    std::uint64_t expulsiones = 0; ///< Entradas descartadas para hacer espacio.
+};
+
+/**
+ * @class CacheLRU
+ * @brief Caché que expulsa la entrada usada hace más tiempo (Least Recently Used).
+ *
+ * La ListaDoble guarda las claves de la más reciente (cabeza) a la más antigua (cola).
+ * Leer o escribir una clave la mueve a la cabeza con moverAlInicio(); expulsar es quitar la cola.
+ * Todas las operaciones cuestan O(1) en promedio.
+ * La capacidad se mide con una función que da el costo de cada entrada: por defecto 1, lo que limita
+ * el número de entradas; si devuelve bytes, la caché queda limitada por memoria.
+ * @tparam K Tipo de la clave.
+ * @tparam V Tipo del valor.
+ * @tparam Hash Función hash para las claves.
+ */
+template <typename K, typename V, typename Hash = std::hash<K>>
+class CacheLRU {
+    public:
+        using Medidor = std::function<std::size_t(const K&, const V&)>;
+
+    private:
+        struct Entrada {
+            V valor;
+            std::size_t costo;
+            typename ListaDoble<K>::iterador posicion; ///< Nodo de la clave en la lista de uso.
+        };
+
+        ListaDoble<K> orden;                        ///< Claves de la más reciente a la más antigua.
+        std::unordered_map<K, Entrada, Hash> indice; ///< De cada clave a su valor y su nodo.
+        std::size_t capacidadMaxima;
+        std::size_t usado;
+        Medidor medir;
+        EstadisticasCache contadores;
+
+        /**
+         * @brief Expulsa la entrada menos reciente.
+         */
+        void expulsar() {
+            auto victima = std::prev(orden.end());
+            auto it = indice.find(*victima);
+            usado -= it->second.costo;
+            indice.erase(it);
+            orden.eliminar(victima);
+            contadores.expulsiones++;
+        }
+
+    public:
+        /**
+         * @brief Constructor de la caché.
+         * @param capacidad Costo total máximo de las entradas.
+         * @param medidor Función que da el costo de una entrada; si se omite, cada entrada cuesta 1.
+         */
+        explicit CacheLRU(std::size_t capacidad, Medidor medidor = nullptr)
+            : capacidadMaxima(capacidad), usado(0), medir(std::move(medidor)) {}
+
+        /**
+         * @brief Busca una clave y la marca como la más reciente.
+         * @param clave Clave a buscar.
+         * @return Puntero al valor, o nullptr si la clave no está. El puntero es válido hasta la siguiente modificación.
+         */
+        V* obtener(const K& clave) {
+            auto it = indice.find(clave);
+            if (it == indice.end()) {
+                contadores.fallos++;
+                return nullptr;
+            }
+            contadores.aciertos++;
+            orden.moverAlInicio(it->second.posicion);
+            return &it->second.valor;
+        }
+
+        /**
+         * @brief Inserta o reemplaza una entrada y la marca como la más reciente.
+         * @param clave Clave de la entrada.
+         * @param valor Valor a guardar.
+         * @return false si la entrada por sí sola supera la capacidad y no se guardó.
+         * Se expulsan las entradas menos recientes hasta que la nueva quepa.
+         */
+        bool insertar(const K& clave, const V& valor) {
+            std::size_t costo = medir ? medir(clave, valor) : 1;
+            if (costo > capacidadMaxima) {
+                return false;
+            }
+            auto it = indice.find(clave);
+            if (it != indice.end()) {
+                usado -= it->second.costo;
+                it->second.valor = valor;
+                it->second.costo = costo;
+                usado += costo;
+                orden.moverAlInicio(it->second.posicion);
+                while (usado > capacidadMaxima) {
+                    expulsar();
+                }
+                return true;
+            }
+            while (usado + costo > capacidadMaxima) {
+                expulsar();
+            }
+            orden.insertarAlInicio(clave);
+            indice.emplace(clave, Entrada{valor, costo, orden.begin()});
+            usado += costo;
+            return true;
+        }
+
+        /**
+         * @brief Elimina una entrada.
+         * @param clave Clave a eliminar.
+         * @return true si la clave estaba en la caché.
+         */
+        bool eliminar(const K& clave) {
+            auto it = indice.find(clave);
+            if (it == indice.end()) {
+                return false;
+            }
+            usado -= it->second.costo;
+            orden.eliminar(it->second.posicion);
+            indice.erase(it);
+            return true;
+        }
+
+        /**
+         * @brief Verifica si una clave está en la caché, sin cambiar su orden ni los contadores.
+         */
+        bool contiene(const K& clave) const {
+            return indice.find(clave) != indice.end();
+        }
+
+        /**
+         * @brief Elimina todas las entradas; los contadores se conservan.
+         */
+        void limpiar() {
+            indice.clear();
+            while (orden.obtenerTamano() > 0) {
+                orden.eliminar(orden.begin());
+            }
+            usado = 0;
+        }
+
+        std::size_t tamano() const { return indice.size(); }   ///< Número de entradas.
+        std::size_t uso() const { return usado; }              ///< Costo total de las entradas.
+        std::size_t capacidad() const { return capacidadMaxima; } ///< Costo total máximo.
+        const EstadisticasCache& estadisticas() const { return contadores; } ///< Aciertos, fallos y expulsiones.
+};
+
+/**
+ * @class CacheLFU
+ * @brief Caché que expulsa la entrada usada menos veces (Least Frequently Used).
+ *
+ * Las claves se agrupan por frecuencia de uso: cada grupo es una ListaDoble ordenada de la más reciente a la más antigua,
+ * y los grupos se guardan en un std::map ordenado por frecuencia. Cada entrada recuerda su grupo y su nodo, así que
+ * subirla al grupo siguiente sólo toca grupos vecinos y la víctima es siempre la cola del primer grupo.
+ * Ante empates de frecuencia se expulsa la entrada menos reciente. Todas las operaciones cuestan O(1) amortizado.
+ * @tparam K Tipo de la clave.
+ * @tparam V Tipo del valor.
+ * @tparam Hash Función hash para las claves.
+ */
+template <typename K, typename V, typename Hash = std::hash<K>>
+class CacheLFU {
+    public:
+        using Medidor = std::function<std::size_t(const K&, const V&)>;
+
+    private:
+        using Grupos = std::map<std::uint64_t, ListaDoble<K>>;
+
+        struct Entrada {
+            V valor;
+            std::size_t costo;
+            std::uint64_t frecuencia;
+            typename Grupos::iterator grupo;           ///< Grupo de la frecuencia actual.
+            typename ListaDoble<K>::iterador posicion; ///< Nodo de la clave dentro del grupo.
+        };
+
+        Grupos grupos;                              ///< Listas de claves por frecuencia, de menor a mayor.
+        std::unordered_map<K, Entrada, Hash> indice; ///< De cada clave a su valor, grupo y nodo.
+        std::size_t capacidadMaxima;
+        std::size_t usado;
+        Medidor medir;
+        EstadisticasCache contadores;
+
+        /**
+         * @brief Devuelve el grupo de una frecuencia, creándolo junto a la pista si no existe.
+         * @param pista Grupo de esa frecuencia o el que debe quedar inmediatamente después.
+         * @param frecuencia Frecuencia del grupo.
+         * Si el grupo ya existe es la propia pista y no se toca el mapa; si no, std::map lo crea junto a la pista
+         * en O(1) amortizado. Sólo se reserva un nodo del mapa cuando de verdad hace falta un grupo nuevo.
+         */
+        typename Grupos::iterator grupoDe(typename Grupos::iterator pista, std::uint64_t frecuencia) {
+            if (pista != grupos.end() && pista->first == frecuencia) {
+                return pista;
+            }
+            return grupos.try_emplace(pista, frecuencia);
+        }
+
+        /**
+         * @brief Quita una clave de su grupo y descarta el grupo si queda vacío.
+         */
+        void quitarDeGrupo(Entrada& entrada) {
+            entrada.grupo->second.eliminar(entrada.posicion);
+            descartarSiVacio(entrada.grupo);
+        }
+
+        /// Elimina el grupo si ya no le quedan claves.
+        void descartarSiVacio(typename Grupos::iterator grupo) {
+            if (grupo->second.obtenerTamano() == 0) {
+                grupos.erase(grupo);
+            }
+        }
+
+        /**
+         * @brief Sube una entrada al grupo de la frecuencia siguiente.
+         * El nodo de la clave se traslada de un grupo al otro sin copiarse ni reservar memoria.
+         */
+        void promover(Entrada& entrada) {
+            auto destino = grupoDe(std::next(entrada.grupo), entrada.frecuencia + 1);
+            entrada.posicion = destino->second.trasladarAlInicio(entrada.grupo->second, entrada.posicion);
+            descartarSiVacio(entrada.grupo);
+            entrada.frecuencia++;
+            entrada.grupo = destino;
+        }
+
+        /**
+         * @brief Expulsa la entrada menos reciente del grupo de menor frecuencia.
+         */
+        void expulsar() {
+            ListaDoble<K>& menor = grupos.begin()->second;
+            auto victima = std::prev(menor.end());
+            auto it = indice.find(*victima);
+            usado -= it->second.costo;
+            quitarDeGrupo(it->second);
+            indice.erase(it);
+            contadores.expulsiones++;
+        }
+
+    public:
+        /**
+         * @brief Constructor de la caché.
+         * @param capacidad Costo total máximo de las entradas.
+         * @param medidor Función que da el costo de una entrada; si se omite, cada entrada cuesta 1.
+         */
+        explicit CacheLFU(std::size_t capacidad, Medidor medidor = nullptr)
+            : capacidadMaxima(capacidad), usado(0), medir(std::move(medidor)) {}
+
+        /**
+         * @brief Busca una clave y aumenta su frecuencia de uso.
+         * @param clave Clave a buscar.
+         * @return Puntero al valor, o nullptr si la clave no está. El puntero es válido hasta la siguiente modificación.
+         */
+        V* obtener(const K& clave) {
+            auto it = indice.find(clave);
+            if (it == indice.end()) {
+                contadores.fallos++;
+                return nullptr;
+            }
+            contadores.aciertos++;
+            promover(it->second);
+            return &it->second.valor;
+        }
+
+        /**
+         * @brief Inserta o reemplaza una entrada.
+         * @param clave Clave de la entrada.
+         * @param valor Valor a guardar.
+         * @return false si la entrada por sí sola supera la capacidad y no se guardó.
+         * Reemplazar cuenta como un uso. Una entrada nueva empieza con frecuencia 1.
+         */
+        bool insertar(const K& clave, const V& valor) {
+            std::size_t costo = medir ? medir(clave, valor) : 1;
+            if (costo > capacidadMaxima) {
+                return false;
+            }
+            auto it = indice.find(clave);
+            if (it != indice.end()) {
+                usado -= it->second.costo;
+                it->second.valor = valor;
+                it->second.costo = costo;
+                usado += costo;
+                promover(it->second);
+                while (usado > capacidadMaxima) {
+                    expulsar();
+                }
+                // Si creció y era la de menor frecuencia, pudo expulsarse a sí misma
+                return contiene(clave);
+            }
+            while (usado + costo > capacidadMaxima) {
+                expulsar();
+            }
+            auto grupo = grupoDe(grupos.begin(), 1);
+            grupo->second.insertarAlInicio(clave);
+            indice.emplace(clave, Entrada{valor, costo, 1, grupo, grupo->second.begin()});
+            usado += costo;
+            return true;
+        }
+
+        /**
+         * @brief Elimina una entrada.
+         * @param clave Clave a eliminar.
+         * @return true si la clave estaba en la caché.
+         */
+        bool eliminar(const K& clave) {
+            auto it = indice.find(clave);
+            if (it == indice.end()) {
+                return false;
+            }
+            usado -= it->second.costo;
+            quitarDeGrupo(it->second);
+            indice.erase(it);
+            return true;
+        }
+
+        /**
+         * @brief Verifica si una clave está en la caché, sin cambiar su frecuencia ni los contadores.
+         */
+        bool contiene(const K& clave) const {
+            return indice.find(clave) != indice.end();
+        }
+
+        /**
+         * @brief Devuelve cuántas veces se ha usado una clave, o 0 si no está.
+         */
+        std::uint64_t frecuencia(const K& clave) const {
+            auto it = indice.find(clave);
+            return it == indice.end() ? 0 : it->second.frecuencia;
+        }
+
+        /**
+         * @brief Elimina todas las entradas; los contadores se conservan.
+         */
+        void limpiar() {
+            indice.clear();
+            grupos.clear();
+            usado = 0;
+        }
+
+        std::size_t tamano() const { return indice.size(); }   ///< Número de entradas.
+        std::size_t uso() const { return usado; }              ///< Costo total de las entradas.
+        std::size_t capacidad() const { return capacidadMaxima; } ///< Costo total máximo.
+        const EstadisticasCache& estadisticas() const { return contadores; } ///< Aciertos, fallos y expulsiones.
+};
+
+#endif
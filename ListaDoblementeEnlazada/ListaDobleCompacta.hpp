@@ -0,0 +1,401 @@
+/**
+ * @file ListaDobleCompacta.hpp
+ * @brief Definición de la clase ListaDobleCompacta, una lista doblemente enlazada sobre un pool de nodos.
+ * Los nodos viven en un único arreglo contiguo y se enlazan con índices de 32 bits en lugar de punteros,
+ * lo que reduce a la mitad el espacio de los enlaces y elimina una reserva de memoria por elemento.
+ */
+#ifndef LISTADOBLECOMPACTA_HPP
+#define LISTADOBLECOMPACTA_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @class ListaDobleCompacta
+ * @brief Lista doblemente enlazada cuyos nodos se reservan de un pool y se enlazan por índice.
+ *
+ * En ListaDoble cada nodo es una reserva independiente con un `std::unique_ptr` y un puntero crudo (16 bytes de enlaces
+ * en 64 bits, más la cabecera del reservador). Aquí todos los nodos están en un std::vector y cada enlace es un índice
+ * dentro de ese arreglo, de 4 bytes con el tipo por defecto. Los nodos eliminados pasan a una lista de libres
+ * y se reutilizan en la siguiente inserción, así que en régimen estable no se reserva memoria.
+ * La interfaz y los iteradores son los de ListaDoble.
+ * Para conservar los enlaces por puntero pero tomar los nodos de un pool, ListaDoble acepta un asignador:
+ * ListaDoblePmr con un RecursoPoolNodos (Memoria/Recursos.hpp).
+ * @tparam T Tipo de dato almacenado; debe tener constructor por defecto.
+ * @tparam Indice Tipo entero sin signo de los enlaces; limita la lista a max(Indice) nodos (ese valor es NULO).
+ * Al pasar el límite, insertar lanza std::length_error.
+ */
+template <typename T, typename Indice = std::uint32_t>
+class ListaDobleCompacta {
+    private:
+        static constexpr Indice NULO = std::numeric_limits<Indice>::max(); ///< Equivale a nullptr.
+
+        /**
+         * @brief Nodo del pool. En un nodo libre, siguiente encadena la lista de libres.
+         */
+        struct Nodo {
+            T dato;
+            Indice siguiente;
+            Indice anterior;
+        };
+
+        std::vector<Nodo> nodos; ///< Pool de nodos, ocupados y libres.
+        Indice cabeza;           ///< Índice del primer nodo.
+        Indice cola;             ///< Índice del último nodo.
+        Indice libres;           ///< Primer nodo de la lista de libres.
+        int tamano;              ///< Número de elementos.
+
+        /**
+         * @brief Toma un nodo del pool: reutiliza uno libre o agrega uno al final del arreglo.
+         * @param valor Valor del nodo.
+         * @return Índice del nodo, todavía sin enlazar.
+         * @throws std::length_error Si el pool ya tiene max(Indice) nodos: el siguiente índice sería NULO.
+         */
+        Indice reservarNodo(const T& valor) {
+            Indice i;
+            if (libres != NULO) {
+                i = libres;
+                libres = nodos[i].siguiente;
+                nodos[i].dato = valor;
+            } else {
+                if (nodos.size() >= static_cast<std::size_t>(NULO)) {
+                    throw std::length_error("ListaDobleCompacta: no quedan índices libres para otro nodo.");
+                }
+                i = static_cast<Indice>(nodos.size());
+                nodos.push_back(Nodo{valor, NULO, NULO});
+            }
+            nodos[i].siguiente = NULO;
+            nodos[i].anterior = NULO;
+            return i;
+        }
+
+        /**
+         * @brief Devuelve un nodo desenlazado a la lista de libres.
+         * @param i Índice del nodo.
+         */
+        void liberarNodo(Indice i) {
+            nodos[i].dato = T(); // Suelta los recursos del valor sin esperar a que el nodo se reutilice
+            nodos[i].siguiente = libres;
+            libres = i;
+        }
+
+        /**
+         * @brief Devuelve el nodo en una posición recorriendo desde el extremo más cercano.
+         * @param posicion Posición válida, entre 0 y tamano - 1.
+         */
+        Indice nodoEn(int posicion) const {
+            if (posicion < tamano / 2) {
+                Indice actual = cabeza;
+                for (int i = 0; i < posicion; ++i) {
+                    actual = nodos[actual].siguiente;
+                }
+                return actual;
+            }
+            Indice actual = cola;
+            for (int i = tamano - 1; i > posicion; --i) {
+                actual = nodos[actual].anterior;
+            }
+            return actual;
+        }
+
+        /**
+         * @class Iterador
+         * @brief Iterador bidireccional; guarda el índice del nodo y la lista que contiene el pool.
+         * Sigue siendo válido mientras no se elimine su nodo, aunque el pool crezca y se mueva en memoria.
+         * @tparam U T para el iterador normal, o const T para el iterador constante.
+         */
+        template <typename U>
+        class Iterador {
+            private:
+                Indice actual;
+                const ListaDobleCompacta* lista;
+                friend class ListaDobleCompacta;
+            public:
+                using iterator_category = std::bidirectional_iterator_tag;
+                using value_type = T;
+                using difference_type = std::ptrdiff_t;
+                using pointer = U*;
+                using reference = U&;
+
+                Iterador(Indice i = NULO, const ListaDobleCompacta* l = nullptr) : actual(i), lista(l) {}
+                // Permite convertir un iterador normal en uno constante
+                Iterador(const Iterador<T>& otro) : actual(otro.actual), lista(otro.lista) {}
+
+                reference operator*() const { return const_cast<U&>(lista->nodos[actual].dato); }
+                pointer operator->() const { return &**this; }
+                Iterador& operator++() {
+                    actual = lista->nodos[actual].siguiente;
+                    return *this;
+                }
+                Iterador operator++(int) {
+                    Iterador copia = *this;
+                    ++(*this);
+                    return copia;
+                }
+                Iterador& operator--() {
+                    // Desde end() se retrocede a la cola
+                    actual = actual != NULO ? lista->nodos[actual].anterior : lista->cola;
+                    return *this;
+                }
+                Iterador operator--(int) {
+                    Iterador copia = *this;
+                    --(*this);
+                    return copia;
+                }
+                bool operator==(const Iterador& otro) const { return actual == otro.actual; }
+                bool operator!=(const Iterador& otro) const { return actual != otro.actual; }
+        };
+
+    public:
+        using iterador = Iterador<T>;
+        using iteradorConstante = Iterador<const T>;
+
+        /**
+         * @brief Constructor de la clase ListaDobleCompacta.
+         * Inicializa la lista vacía, con el pool sin nodos.
+         */
+        ListaDobleCompacta() : cabeza(NULO), cola(NULO), libres(NULO), tamano(0) {}
+
+        iterador begin() { return iterador(cabeza, this); }
+        iterador end() { return iterador(NULO, this); }
+        iteradorConstante begin() const { return iteradorConstante(cabeza, this); }
+        iteradorConstante end() const { return iteradorConstante(NULO, this); }
+
+        /**
+         * @brief Reserva espacio en el pool para la cantidad indicada de nodos.
+         * @param capacidad Número de nodos esperados.
+         * Reservar de antemano evita que el arreglo se copie al crecer.
+         */
+        void reservar(std::size_t capacidad) {
+            nodos.reserve(capacidad);
+        }
+
+        /**
+         * @brief Devuelve el número de elementos de la lista.
+         */
+        int obtenerTamano() const {
+            return tamano;
+        }
+
+        /**
+         * @brief Devuelve los bytes que ocupa el pool, contando los nodos libres.
+         */
+        std::size_t memoriaUsada() const {
+            return nodos.capacity() * sizeof(Nodo);
+        }
+
+        /**
+         * @brief Inserta un nuevo nodo al inicio de la lista.
+         * @param valor El valor del nuevo nodo a insertar.
+         */
+        void insertarAlInicio(const T& valor) {
+            Indice nuevo = reservarNodo(valor);
+            nodos[nuevo].siguiente = cabeza;
+            if (cabeza != NULO) {
+                nodos[cabeza].anterior = nuevo;
+            } else {
+                cola = nuevo;
+            }
+            cabeza = nuevo;
+            tamano++;
+        }
+
+        /**
+         * @brief Inserta un nuevo nodo al final de la lista.
+         * @param valor El valor del nuevo nodo a insertar.
+         */
+        void insertarAlFinal(const T& valor) {
+            Indice nuevo = reservarNodo(valor);
+            nodos[nuevo].anterior = cola;
+            if (cola != NULO) {
+                nodos[cola].siguiente = nuevo;
+            } else {
+                cabeza = nuevo;
+            }
+            cola = nuevo;
+            tamano++;
+        }
+
+        /**
+         * @brief Inserta un nuevo nodo antes de la posición indicada por un iterador, en O(1).
+         * @param posicion Iterador al elemento que quedará después del nuevo; end() inserta al final.
+         * @param valor El valor a insertar.
+         * @return Iterador al nuevo elemento.
+         */
+        iterador insertar(iterador posicion, const T& valor) {
+            Indice siguiente = posicion.actual;
+            if (siguiente == NULO) {
+                insertarAlFinal(valor);
+                return iterador(cola, this);
+            }
+            if (siguiente == cabeza) {
+                insertarAlInicio(valor);
+                return begin();
+            }
+            Indice previo = nodos[siguiente].anterior;
+            Indice nuevo = reservarNodo(valor);
+            nodos[nuevo].anterior = previo;
+            nodos[nuevo].siguiente = siguiente;
+            nodos[previo].siguiente = nuevo;
+            nodos[siguiente].anterior = nuevo;
+            tamano++;
+            return iterador(nuevo, this);
+        }
+
+        /**
+         * @brief Elimina el elemento indicado por un iterador, en O(1).
+         * @param posicion Iterador a un elemento de la lista (no end()).
+         * @return Iterador al elemento que seguía al eliminado, o end().
+         * El nodo vuelve a la lista de libres del pool.
+         */
+        iterador eliminar(iterador posicion) {
+            Indice actual = posicion.actual;
+            Indice previo = nodos[actual].anterior;
+            Indice siguiente = nodos[actual].siguiente;
+            if (previo != NULO) {
+                nodos[previo].siguiente = siguiente;
+            } else {
+                cabeza = siguiente;
+            }
+            if (siguiente != NULO) {
+                nodos[siguiente].anterior = previo;
+            } else {
+                cola = previo;
+            }
+            liberarNodo(actual);
+            tamano--;
+            return iterador(siguiente, this);
+        }
+
+        /**
+         * @brief Mueve el nodo indicado por un iterador al inicio de la lista, en O(1).
+         * @param posicion Iterador a un elemento de la lista (no end()).
+         */
+        void moverAlInicio(iterador posicion) {
+            Indice actual = posicion.actual;
+            if (actual == cabeza) {
+                return;
+            }
+            Indice previo = nodos[actual].anterior;
+            Indice siguiente = nodos[actual].siguiente;
+            nodos[previo].siguiente = siguiente;
+            if (siguiente != NULO) {
+                nodos[siguiente].anterior = previo;
+            } else {
+                cola = previo;
+            }
+            nodos[actual].anterior = NULO;
+            nodos[actual].siguiente = cabeza;
+            nodos[cabeza].anterior = actual;
+            cabeza = actual;
+        }
+
+        /**
+         * @brief Inserta un nuevo nodo en la posición indicada.
+         * @param posicion La posición que ocupará el nuevo nodo (0 es el primero); más allá del final inserta al final.
+         * @param valor El valor a insertar.
+         */
+        void insertarEnPosicion(int posicion, T valor) {
+            if (posicion < 0) {
+                std::cout << "Posición inválida." << std::endl;
+                return;
+            }
+            if (posicion >= tamano) {
+                insertarAlFinal(valor);
+                return;
+            }
+            insertar(iterador(nodoEn(posicion), this), valor);
+        }
+
+        /**
+         * @brief Elimina el nodo en la posición indicada.
+         * @param posicion La posición del nodo a eliminar (0 es el primero).
+         */
+        void eliminarEnPosicion(int posicion) {
+            if (posicion < 0 || tamano == 0) {
+                std::cout << "Posición inválida o lista vacía." << std::endl;
+                return;
+            }
+            if (posicion >= tamano) {
+                std::cout << "No se encontró un nodo en la posición " << posicion << "." << std::endl;
+                return;
+            }
+            eliminar(iterador(nodoEn(posicion), this));
+        }
+
+        /**
+         * @brief Busca un valor en la lista.
+         * @param valor El valor a buscar.
+         * @return La posición del primer nodo con ese valor, o -1 si no se encuentra.
+         */
+        int buscar(const T& valor) const {
+            int posicion = 0;
+            for (Indice actual = cabeza; actual != NULO; actual = nodos[actual].siguiente) {
+                if (nodos[actual].dato == valor) {
+                    return posicion;
+                }
+                posicion++;
+            }
+            return -1;
+        }
+
+        /**
+         * @brief Busca un valor y devuelve un iterador a su nodo.
+         * @param valor El valor a buscar.
+         * @return Iterador al primer nodo con ese valor, o end() si no se encuentra.
+         */
+        iterador encontrar(const T& valor) {
+            for (iterador it = begin(); it != end(); ++it) {
+                if (*it == valor) {
+                    return it;
+                }
+            }
+            return end();
+        }
+
+        /**
+         * @brief Muestra los elementos de la lista hacia adelante.
+         */
+        void mostrarAdelante() const {
+            if (cabeza == NULO) {
+                std::cout << "La lista está vacía." << std::endl;
+                return;
+            }
+            std::cout << "Elementos de la lista (adelante): ";
+            for (Indice actual = cabeza; actual != NULO; actual = nodos[actual].siguiente) {
+                std::cout << nodos[actual].dato << " ";
+            }
+            std::cout << std::endl;
+        }
+
+        /**
+         * @brief Muestra los elementos de la lista hacia atrás.
+         */
+        void mostrarAtras() const {
+            if (cola == NULO) {
+                std::cout << "La lista está vacía." << std::endl;
+                return;
+            }
+            std::cout << "Elementos de la lista (atrás): ";
+            for (Indice actual = cola; actual != NULO; actual = nodos[actual].anterior) {
+                std::cout << nodos[actual].dato << " ";
+            }
+            std::cout << std::endl;
+        }
+
+        /**
+         * @brief Elimina todos los elementos y libera el pool de una sola vez.
+         */
+        void limpiar() {
+            nodos.clear();
+            cabeza = cola = libres = NULO;
+            tamano = 0;
+        }
+};
+
+#endif
@@ -1,37 +1,39 @@
 /**
  * 
- * @file nodo.hpp
- * @brief Definicion de la estructura Nodo para una lista doblemente enlazada.
+ * @file NodoDoble.hpp
+ * @brief Definicion de la estructura NodoDoble para una lista doblemente enlazada.
  * Esta estructura es utilizada para almacenar datos de tipo T y referencias
  * a los nodos siguiente y anterior.
  *  
  **/
 
-#ifndef NODO_HPP
-#define NODO_HPP
+#ifndef NODODOBLE_HPP
+#define NODODOBLE_HPP
 
+#include "../Memoria/GestorNodos.hpp"
 #include <memory>
 
 /**
- * @brief Estructura Nodo para una lista doblemente enlazada.
+ * @brief Estructura NodoDoble para una lista doblemente enlazada.
  * Esta estructura almacena un dato de tipo T, un puntero inteligente
  * al siguiente nodo y un puntero al nodo anterior.
+ * El puntero al siguiente usa el asignador de la lista para liberar el nodo.
  *  
  **/
-template <typename T>
-struct Nodo {
+template <typename T, typename Asignador = std::allocator<T>>
+struct NodoDoble {
     // Tipo de dato almacenado en el nodo
     T dato;
     // Puntero inteligente al siguiente nodo
     // Utilizamos std::unique_ptr para manejar la memoria automáticamente
-    std::unique_ptr<Nodo<T>> siguiente;
+    PunteroNodo<NodoDoble<T, Asignador>, Asignador> siguiente;
     // Puntero al nodo anterior
-    Nodo<T>* anterior;
+    NodoDoble* anterior;
 
     /**
      * @brief Constructor por defecto que inicializa el nodo sin datos.
      */
-    Nodo(const T& d) : dato(d), siguiente(nullptr), anterior(nullptr) {}
+    NodoDoble(const T& d) : dato(d), siguiente(nullptr), anterior(nullptr) {}
 };
 
 #endif
\ No newline at end of file
@@ -3,12 +3,17 @@
  * @brief Definición de la clase ListaDoble.
  * Esta clase implementa una lista doblemente enlazada utilizando punteros inteligentes.
  * Permite insertar elementos al final, mostrar los elementos hacia adelante y hacia atrás.
+ * Los nodos se crean con un asignador configurable, de modo que la lista puede vivir en una arena o en un pool.
 */
 #ifndef LISTADOBLE_HPP
 #define LISTADOBLE_HPP
 
-#include "nodo.hpp"
+#include "NodoDoble.hpp"
+#include "../Instrumentacion/Instrumentacion.hpp"
+#include <cstddef>
 #include <iostream>
+#include <iterator>
+#include <memory_resource>
 
 /**
  * @class ListaDoble
@@ -16,18 +21,171 @@
  * 
  * Esta clase permite insertar elementos al final de la lista, mostrar los elementos hacia adelante
  * y hacia atrás. Utiliza punteros inteligentes para gestionar la memoria de manera eficiente.
+ * @tparam Instrumentacion Política de instrumentación; por defecto no mide nada.
+ * @tparam Asignador Asignador de los nodos: `std::allocator` o compatible, o `std::pmr::polymorphic_allocator`.
  */
-template <typename T>
+template <typename T, typename Instrumentacion = SinInstrumentacion, typename Asignador = std::allocator<T>>
 class ListaDoble {
         private:
-            std::unique_ptr<Nodo<T>> cabeza; // Puntero inteligente al primer nodo de la lista
-            Nodo<T>* cola;   // Puntero al último nodo de la lista
+            using NodoL = NodoDoble<T, Asignador>;
+            using Enlace = PunteroNodo<NodoL, Asignador>;
+
+            GestorNodos<NodoL, Asignador> gestor; // Crea los nodos con el asignador de la lista
+            Enlace cabeza; // Puntero inteligente al primer nodo de la lista
+            NodoL* cola;   // Puntero al último nodo de la lista
+            int tamano;      // Número de nodos, permite decidir desde qué extremo recorrer
+
+            /**
+             * @brief Devuelve el nodo en una posición recorriendo desde el extremo más cercano.
+             * @param posicion Posición válida, entre 0 y tamano - 1.
+             * Si la posición está en la primera mitad se avanza desde la cabeza; si no, se retrocede desde la cola.
+             * Así nunca se recorren más de la mitad de los nodos.
+             */
+            NodoL* nodoEn(int posicion) const {
+                if (posicion < tamano / 2) {
+                    NodoL* actual = cabeza.get();
+                    for (int i = 0; i < posicion; ++i) {
+                        Instrumentacion::salto();
+                        actual = actual->siguiente.get();
+                    }
+                    return actual;
+                }
+                NodoL* actual = cola;
+                for (int i = tamano - 1; i > posicion; --i) {
+                    Instrumentacion::salto();
+                    actual = actual->anterior;
+                }
+                return actual;
+            }
+
+            /**
+             * @class Iterador
+             * @brief Iterador bidireccional sobre los elementos de la lista.
+             * Avanza por siguiente y retrocede por anterior, ambos en O(1).
+             * Guarda también la lista para poder retroceder desde end() hasta la cola.
+             * Un iterador sigue siendo válido mientras no se elimine el nodo al que apunta.
+             * @tparam U T para el iterador normal, o const T para el iterador constante.
+             */
+            template <typename U>
+            class Iterador {
+                private:
+                    NodoL* actual;
+                    const ListaDoble* lista;
+                    friend class ListaDoble;
+                public:
+                    using iterator_category = std::bidirectional_iterator_tag;
+                    using value_type = T;
+                    using difference_type = std::ptrdiff_t;
+                    using pointer = U*;
+                    using reference = U&;
+
+                    Iterador(NodoL* nodo = nullptr, const ListaDoble* l = nullptr) : actual(nodo), lista(l) {}
+                    // Permite convertir un iterador normal en uno constante
+                    Iterador(const Iterador<T>& otro) : actual(otro.actual), lista(otro.lista) {}
+
+                    reference operator*() const { return actual->dato; }
+                    pointer operator->() const { return &actual->dato; }
+                    Iterador& operator++() {
+                        actual = actual->siguiente.get();
+                        return *this;
+                    }
+                    Iterador operator++(int) {
+                        Iterador copia = *this;
+                        ++(*this);
+                        return copia;
+                    }
+                    Iterador& operator--() {
+                        // Desde end() se retrocede a la cola
+                        actual = actual ? actual->anterior : lista->cola;
+                        return *this;
+                    }
+                    Iterador operator--(int) {
+                        Iterador copia = *this;
+                        --(*this);
+                        return copia;
+                    }
+                    bool operator==(const Iterador& otro) const { return actual == otro.actual; }
+                    bool operator!=(const Iterador& otro) const { return actual != otro.actual; }
+            };
+
         public:
+            using iterador = Iterador<T>;
+            using iteradorConstante = Iterador<const T>;
+
             /**
             * @brief Constructor de la clase ListaDoble.
             * Inicializa la lista doblemente enlazada estableciendo los punteros cabeza y cola a nullptr.
             */
-            ListaDoble() : cabeza(nullptr), cola(nullptr) {}
+            explicit ListaDoble(const Asignador& asignador = Asignador())
+                : gestor(asignador), cabeza(nullptr), cola(nullptr), tamano(0) {}
+
+            /**
+             * @brief Destructor de la lista; libera los nodos de forma iterativa con limpiar().
+             */
+            ~ListaDoble() {
+                limpiar();
+            }
+
+            ListaDoble(const ListaDoble&) = delete;
+            ListaDoble& operator=(const ListaDoble&) = delete;
+
+            /**
+             * @brief Constructor de movimiento: toma los nodos y el asignador de otra lista, que queda vacía.
+             */
+            ListaDoble(ListaDoble&& otra) noexcept
+                : gestor(otra.gestor), cabeza(std::move(otra.cabeza)), cola(otra.cola), tamano(otra.tamano) {
+                otra.cola = nullptr;
+                otra.tamano = 0;
+            }
+
+            /**
+             * @brief Asignación por movimiento: libera los nodos propios y toma los de otra lista.
+             * La lista conserva su asignador; los nodos tomados vuelven al de la otra lista cuando se liberan.
+             */
+            ListaDoble& operator=(ListaDoble&& otra) noexcept {
+                if (this != &otra) {
+                    limpiar();
+                    cabeza = std::move(otra.cabeza);
+                    cola = otra.cola;
+                    tamano = otra.tamano;
+                    otra.cola = nullptr;
+                    otra.tamano = 0;
+                }
+                return *this;
+            }
+
+            /**
+             * @brief Devuelve una copia del asignador con el que se crean los nodos.
+             */
+            Asignador obtenerAsignador() const {
+                return gestor.obtenerAsignador();
+            }
+
+            /**
+             * @brief Elimina todos los nodos, uno por uno desde la cabeza para no encadenar destructores.
+             */
+            void limpiar() {
+                while (cabeza) {
+                    cabeza = std::move(cabeza->siguiente);
+                }
+                cola = nullptr;
+                tamano = 0;
+            }
+
+            /**
+             * @brief Iteradores al primer elemento y a la posición siguiente al último.
+             */
+            iterador begin() { return iterador(cabeza.get(), this); }
+            iterador end() { return iterador(nullptr, this); }
+            iteradorConstante begin() const { return iteradorConstante(cabeza.get(), this); }
+            iteradorConstante end() const { return iteradorConstante(nullptr, this); }
+
+            /**
+             * @brief Devuelve el número de elementos de la lista.
+             */
+            int obtenerTamano() const {
+                return tamano;
+            }
 
             /**
             * @brief Inserta un nuevo nodo al inicio de la lista.
@@ -38,7 +196,9 @@ class ListaDoble {
             * Si la lista está vacía, el nuevo nodo se convierte en la cabeza y la cola de la lista.
              */
             void insertarAlInicio(const T& valor) {
-                auto nuevoNodo = std::make_unique<Nodo<T>>(valor);
+                typename Instrumentacion::Temporizador medir("lista_doble_insertar_inicio");
+                Instrumentacion::asignacion();
+                auto nuevoNodo = gestor.crear(valor);
                 // Si la lista está vacía, asignamos el nuevo nodo a cabeza y cola
                 if (!cabeza) {
                     cola = nuevoNodo.get();
@@ -46,11 +206,12 @@ class ListaDoble {
                 } 
                 // Si la lista no está vacía, enlazamos el nuevo nodo al inicio
                 else {
-                    Nodo<T>* nodoActual = cabeza.get(); //Guardamos el puntero antes de mover
+                    NodoL* nodoActual = cabeza.get(); //Guardamos el puntero antes de mover
                     nuevoNodo->siguiente = std::move(cabeza);
                     nodoActual->anterior = nuevoNodo.get(); // Enlazamos el nodo actual como anterior del nuevo nodo
                     cabeza = std::move(nuevoNodo);
                 }
+                tamano++;
             }
 
 
@@ -63,9 +224,11 @@ class ListaDoble {
              * Si la lista está vacía, el nuevo nodo se convierte en la cabeza y la cola de la lista.
              */
             void insertarAlFinal(const T& valor){
+                typename Instrumentacion::Temporizador medir("lista_doble_insertar_final");
+                Instrumentacion::asignacion();
                 // Crear un nuevo nodo con el valor proporcionado
-                // Utilizamos std::make_unique para crear un nodo con puntero inteligente
-                auto nuevoNodo = std::make_unique<Nodo<T>>(valor);
+                // El gestor crea el nodo con el asignador de la lista y lo envuelve en un puntero inteligente
+                auto nuevoNodo = gestor.crear(valor);
                 // Si la lista está vacía, el nuevo nodo se convierte en la cabeza y la cola
                 // Si la lista no está vacía, se enlaza el nuevo nodo al final de la lista
                 if(!cabeza){
@@ -80,47 +243,142 @@ class ListaDoble {
                     cola->siguiente = std::move(nuevoNodo);
                     cola = cola->siguiente.get();
                 }
+                tamano++;
             }
 
-            void insertarEnPosicion(int posicion, T valor) {
-                // Verifica si la posición es válida
-                if (posicion < 0) {
-                    std::cout << "Posición inválida." << std::endl;
-                    return;
+            /**
+             * @brief Inserta un nuevo nodo antes de la posición indicada por un iterador.
+             * @param posicion Iterador al elemento que quedará después del nuevo; end() inserta al final.
+             * @param valor El valor a insertar.
+             * @return Iterador al nuevo elemento.
+             * Sólo se reenlazan los vecinos, sin recorrer la lista: O(1).
+             */
+            iterador insertar(iterador posicion, const T& valor) {
+                NodoL* siguiente = posicion.actual;
+                if (!siguiente) {
+                    insertarAlFinal(valor);
+                    return iterador(cola, this);
                 }
-                // Si la posición es 0, inserta al inicio
-                if (posicion == 0) {
+                if (siguiente == cabeza.get()) {
                     insertarAlInicio(valor);
-                    return;
+                    return begin();
                 }
-                // Crea un nuevo nodo con el valor proporcionado
-                auto nuevo = std::make_unique<Nodo<T>>(valor);
-                Nodo<T>* actual = cabeza.get();
-                int indice = 0;
+                NodoL* previo = siguiente->anterior;
+                Instrumentacion::asignacion();
+                auto nuevo = gestor.crear(valor);
+                NodoL* nuevoPtr = nuevo.get();
+                nuevo->anterior = previo;
+                nuevo->siguiente = std::move(previo->siguiente);
+                siguiente->anterior = nuevoPtr;
+                previo->siguiente = std::move(nuevo);
+                tamano++;
+                return iterador(nuevoPtr, this);
+            }
 
-                // Recorre la lista hasta encontrar la posición deseada
-                while (actual && indice < posicion - 1) {
-                    actual = actual->siguiente.get();
-                    indice++;
+            /**
+             * @brief Elimina el elemento indicado por un iterador.
+             * @param posicion Iterador a un elemento de la lista (no end()).
+             * @return Iterador al elemento que seguía al eliminado, o end().
+             * Sólo se reenlazan los vecinos, sin recorrer la lista: O(1).
+             */
+            iterador eliminar(iterador posicion) {
+                NodoL* actual = posicion.actual;
+                NodoL* previo = actual->anterior;
+                // El dueño del nodo es el siguiente del nodo previo, o cabeza si es el primero
+                Enlace& duenio = previo ? previo->siguiente : cabeza;
+                if (actual == cola) {
+                    cola = previo;
+                } else {
+                    actual->siguiente->anterior = previo;
                 }
+                duenio = std::move(actual->siguiente); // Libera el nodo actual
+                tamano--;
+                return iterador(duenio.get(), this);
+            }
 
-                // Si se llegó al final de la lista, inserta al final
-                if (!actual) {
-                    insertarAlFinal(valor);
+            /**
+             * @brief Mueve el nodo indicado por un iterador al inicio de la lista.
+             * @param posicion Iterador a un elemento de la lista (no end()).
+             * El nodo no se destruye ni se copia: se desenlaza de sus vecinos y se enlaza como nueva cabeza, en O(1).
+             * El iterador sigue siendo válido y ahora apunta al primer elemento.
+             */
+            void moverAlInicio(iterador posicion) {
+                NodoL* actual = posicion.actual;
+                if (actual == cabeza.get()) {
                     return;
                 }
+                NodoL* previo = actual->anterior;
+                // Tomamos la propiedad del nodo desde el siguiente de su nodo previo
+                Enlace nodo = std::move(previo->siguiente);
+                previo->siguiente = std::move(nodo->siguiente);
+                if (previo->siguiente) {
+                    previo->siguiente->anterior = previo;
+                } else {
+                    cola = previo; // El nodo movido era la cola
+                }
+                nodo->anterior = nullptr;
+                cabeza->anterior = nodo.get();
+                nodo->siguiente = std::move(cabeza);
+                cabeza = std::move(nodo);
+            }
 
-                // Enlaza el nuevo nodo en la posición deseada
-                nuevo->siguiente = std::move(actual->siguiente);
-                nuevo->anterior = actual;
-
-                if (nuevo->siguiente) {
-                    nuevo->siguiente->anterior = nuevo.get();
+            /**
+             * @brief Mueve un nodo de otra lista al inicio de esta, sin destruirlo ni copiarlo.
+             * @param origen Lista que contiene el nodo; puede ser esta misma.
+             * @param posicion Iterador de origen a un elemento (no end()).
+             * @return Iterador al nodo movido, ahora primer elemento de esta lista.
+             * Sólo se reenlazan los vecinos en las dos listas, en O(1) y sin reservar memoria.
+             * El nodo conserva el asignador con el que se creó y vuelve a él cuando se libera.
+             */
+            iterador trasladarAlInicio(ListaDoble& origen, iterador posicion) {
+                NodoL* actual = posicion.actual;
+                if (&origen == this) {
+                    moverAlInicio(posicion);
+                    return begin();
+                }
+                NodoL* previo = actual->anterior;
+                // Tomamos la propiedad del nodo y cerramos el hueco en la lista de origen
+                Enlace& duenio = previo ? previo->siguiente : origen.cabeza;
+                Enlace nodo = std::move(duenio);
+                duenio = std::move(nodo->siguiente);
+                if (duenio) {
+                    duenio->anterior = previo;
+                } else {
+                    origen.cola = previo; // El nodo movido era la cola
+                }
+                origen.tamano--;
+                nodo->anterior = nullptr;
+                if (cabeza) {
+                    cabeza->anterior = actual;
                 } else {
-                    cola = nuevo.get(); // Actualiza la cola si se inserta al final
+                    cola = actual;
                 }
+                nodo->siguiente = std::move(cabeza);
+                cabeza = std::move(nodo);
+                tamano++;
+                return begin();
+            }
 
-                actual->siguiente = std::move(nuevo);
+            /**
+             * @brief Inserta un nuevo nodo en la posición indicada.
+             * @param posicion La posición que ocupará el nuevo nodo (0 es el primero).
+             * @param valor El valor a insertar.
+             * Si la posición está más allá del final, el nodo se inserta al final.
+             * El nodo de la posición se localiza desde el extremo más cercano, por lo que se recorre a lo sumo media lista.
+             */
+            void insertarEnPosicion(int posicion, T valor) {
+                typename Instrumentacion::Temporizador medir("lista_doble_insertar_en_posicion");
+                // Verifica si la posición es válida
+                if (posicion < 0) {
+                    std::cout << "Posición inválida." << std::endl;
+                    return;
+                }
+                // Si se llegó al final de la lista, inserta al final
+                if (posicion >= tamano) {
+                    insertarAlFinal(valor);
+                    return;
+                }
+                insertar(iterador(nodoEn(posicion), this), valor);
             }
 
             /**
@@ -137,7 +395,7 @@ class ListaDoble {
                 }
                 // Recorre la lista e imprime los valores de cada nodo
                 std::cout << "Elementos de la lista (adelante): ";
-                Nodo<T>* actual = cabeza.get();
+                NodoL* actual = cabeza.get();
                 while(actual) {
 
                     std::cout << actual->dato << " ";
@@ -161,7 +419,7 @@ class ListaDoble {
                 }
                 // Recorre la lista e imprime los valores de cada nodo hacia atrás
                 std::cout << "Elementos de la lista (atrás): ";
-                Nodo<T>* actual = cola;
+                NodoL* actual = cola;
                 while(actual) {
                     std::cout << actual->dato << " ";
                     actual = actual->anterior;
@@ -170,84 +428,74 @@ class ListaDoble {
             }
 
             /**
-             * @brief Elimina un nodo con un valor específico de la lista.
+             * @brief Elimina el nodo en la posición indicada.
              * 
-             * @param valor El valor del nodo a eliminar.
+             * @param posicion La posición del nodo a eliminar (0 es el primero).
              * 
-             * Este método busca un nodo con el valor especificado y lo elimina de la lista.
-             * Si el nodo es encontrado, se actualizan los punteros del nodo anterior y siguiente.
-             * Si no se encuentra el nodo, muestra un mensaje.
+             * El nodo se localiza desde el extremo más cercano y se desenlaza actualizando los punteros
+             * del nodo anterior y del siguiente. Si no existe un nodo en esa posición, muestra un mensaje.
              */
             void eliminarEnPosicion(int posicion) {
+                typename Instrumentacion::Temporizador medir("lista_doble_eliminar_en_posicion");
                 // Verifica si la posición es válida
                 if (posicion < 0 || !cabeza) {
                     std::cout << "Posición inválida o lista vacía." << std::endl;
                     return;
                 }
-                Nodo<T>* actual = cabeza.get();
-                int indice = 0;
-
-                // Recorre la lista hasta encontrar el nodo en la posición deseada
-                while (actual && indice < posicion) {
-                    actual = actual->siguiente.get();
-                    indice++;
-                }
-
-                // Si no se encontró el nodo, muestra un mensaje
-                if (!actual) {
+                // Si no existe el nodo, muestra un mensaje
+                if (posicion >= tamano) {
                     std::cout << "No se encontró un nodo en la posición " << posicion << "." << std::endl;
                     return;
                 }
-
-                // Si el nodo a eliminar es la cabeza
-                if (actual == cabeza.get()) {
-                    cabeza = std::move(actual->siguiente);
-                    if (cabeza) {
-                        cabeza->anterior = nullptr;
-                    } else {
-                        cola = nullptr; // Si la lista queda vacía, actualiza la cola
-                    }
-                } else if (actual == cola) { // Si el nodo a eliminar es la cola
-                    cola = actual->anterior;
-                    if (cola) {
-                        cola->siguiente.reset();
-                    } else {
-                        cabeza = nullptr; // Si la lista queda vacía, actualiza la cabeza
-                    }
-                } else { // Si el nodo a eliminar está en medio de la lista
-                    actual->anterior->siguiente = std::move(actual->siguiente);
-                    if (actual->siguiente) {
-                        actual->siguiente->anterior = actual->anterior;
-                    }
-                }
+                eliminar(iterador(nodoEn(posicion), this));
             }
 
             /**
              * @brief Busca un valor en la lista.
              * 
              * @param valor El valor a buscar en la lista.
+             * @return La posición del primer nodo con ese valor (0 es el primero), o -1 si no se encuentra.
              * 
-             * Este método recorre la lista y busca un nodo con el valor especificado.
-             * Si se encuentra el nodo, muestra un mensaje indicando que el valor fue encontrado y especifica la posición en la que se encuentra.
-             * Si no se encuentra, muestra un mensaje indicando que el valor no está en la lista.
+             * Este método recorre la lista desde la cabeza y no imprime nada.
              */
-            void buscar(const T& valor) const {
-                Nodo<T>* actual = cabeza.get();
+            int buscar(const T& valor) const {
+                typename Instrumentacion::Temporizador medir("lista_doble_buscar");
+                NodoL* actual = cabeza.get();
                 int posicion = 0;
 
                 // Recorre la lista buscando el valor
                 while (actual) {
+                    Instrumentacion::comparacion();
                     if (actual->dato == valor) {
-                        std::cout << "Valor " << valor << " encontrado en la posición " << posicion << "." << std::endl;
-                        return;
+                        return posicion;
                     }
+                    Instrumentacion::salto();
                     actual = actual->siguiente.get();
                     posicion++;
                 }
+                return -1;
+            }
 
-                // Si no se encontró el valor, muestra un mensaje
-                std::cout << "Valor " << valor << " no encontrado en la lista." << std::endl;
+            /**
+             * @brief Busca un valor y devuelve un iterador a su nodo.
+             * @param valor El valor a buscar.
+             * @return Iterador al primer nodo con ese valor, o end() si no se encuentra.
+             */
+            iterador encontrar(const T& valor) {
+                typename Instrumentacion::Temporizador medir("lista_doble_encontrar");
+                for (iterador it = begin(); it != end(); ++it) {
+                    Instrumentacion::comparacion();
+                    if (*it == valor) {
+                        return it;
+                    }
+                }
+                return end();
             }
         
 };
-#endif
\ No newline at end of file
+
+/// Lista doble cuyos nodos se piden a un `std::pmr::memory_resource`, por ejemplo RecursoMonotono o RecursoPoolNodos.
+template <typename T, typename Instrumentacion = SinInstrumentacion>
+using ListaDoblePmr = ListaDoble<T, Instrumentacion, std::pmr::polymorphic_allocator<T>>;
+
+#endif
@@ -1,4 +1,6 @@
 #include "listaDoble.hpp"
+#include "Cache.hpp"
+#include "ListaDobleCompacta.hpp"
 #include <string>
 
 int main() {
@@ -37,8 +39,53 @@ int main() {
     listaEnteros.mostrarAdelante();
     listaEnteros.mostrarAtras();
 
-    // Buscar un valor en la lista
-    listaEnteros.buscar(20);
+    // Buscar un valor en la lista: buscar devuelve la posición o -1
+    int posicion = listaEnteros.buscar(20);
+    if (posicion >= 0) {
+        std::cout << "Valor 20 encontrado en la posición " << posicion << "." << std::endl;
+    } else {
+        std::cout << "Valor 20 no encontrado en la lista." << std::endl;
+    }
+
+    // Recorrer con iteradores en ambos sentidos
+    std::cout << "Recorrido con iteradores hacia atrás: ";
+    for (auto it = listaEnteros.end(); it != listaEnteros.begin();) {
+        --it;
+        std::cout << *it << " ";
+    }
+    std::cout << std::endl;
+
+    // Insertar y eliminar en O(1) a partir de un iterador
+    auto it = listaEnteros.encontrar(25);
+    listaEnteros.insertar(it, 22);
+    listaEnteros.eliminar(it);
+    std::cout << "Después de insertar 22 antes del 25 y eliminar el 25:" << std::endl;
+    listaEnteros.mostrarAdelante();
+
+    // Caché LRU construida sobre ListaDoble: con capacidad 2, leer "a" hace que la expulsada sea "b"
+    CacheLRU<std::string, int> cache(2);
+    cache.insertar("a", 1);
+    cache.insertar("b", 2);
+    cache.obtener("a");
+    cache.insertar("c", 3);
+    std::cout << "La caché LRU " << (cache.contiene("b") ? "conserva" : "expulsó") << " la clave b" << std::endl;
+    cache.obtener("b");
+    const EstadisticasCache& estadisticas = cache.estadisticas();
+    std::cout << "Aciertos: " << estadisticas.aciertos << ", fallos: " << estadisticas.fallos
+              << ", expulsiones: " << estadisticas.expulsiones << std::endl;
+
+    // Lista compacta: mismos métodos, nodos en un pool contiguo enlazados con índices de 32 bits
+    ListaDobleCompacta<int> compacta;
+    compacta.reservar(1000000);
+    for (int i = 0; i < 1000000; ++i) {
+        compacta.insertarAlFinal(i);
+    }
+    compacta.eliminarEnPosicion(0);
+    compacta.insertarAlInicio(-1);
+    std::cout << "Lista compacta con " << compacta.obtenerTamano() << " elementos, primer elemento "
+              << *compacta.begin() << ", último " << *std::prev(compacta.end()) << std::endl;
+    std::cout << "Bytes por nodo: ListaDoble " << sizeof(NodoDoble<int>) << " (más la cabecera de cada reserva), "
+              << "ListaDobleCompacta " << compacta.memoriaUsada() / 1000000 << std::endl;
 
     return 0;
 }
\ No newline at end of file
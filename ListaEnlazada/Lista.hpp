@@ -3,13 +3,20 @@
  * @brief Definición de la clase Lista para una lista enlazada.
  * Esta clase es parte de una implementación de una lista enlazada simple.
  * Utiliza punteros inteligentes para manejar la memoria de manera segura.
+ * Los nodos se crean con un asignador configurable, de modo que la lista puede vivir en una arena o en un pool.
  */
 #ifndef LISTA_HPP
 #define LISTA_HPP
 #include "Nodo.hpp"
+#include "../Instrumentacion/Instrumentacion.hpp"
+#include <cstddef>
+#include <functional>
 #include <iostream>
+#include <iterator>
+#include <memory_resource>
+#include <unordered_set>
 
-template <typename T>
+template <typename T, typename Instrumentacion = SinInstrumentacion, typename Asignador = std::allocator<T>>
 
 /**
  * @class Lista
@@ -19,36 +26,138 @@ template <typename T>
  * Esta clase proporciona operaciones básicas como inserción al inicio, eliminación de un elemento, búsqueda de un elemento y visualización de la lista.
  * Una lista enlazada es una estructura de datos que consiste en punteros que conectan nodos, donde cada nodo contiene un valor y un puntero al siguiente nodo.
  * Recuerda, una lista no contiene nodos, contiene un puntero al primer nodo, y los nodos contienen los datos y un puntero al siguiente nodo.
+ * @tparam Instrumentacion Política de instrumentación; por defecto no mide nada.
+ * @tparam Asignador Asignador de los nodos: `std::allocator` o compatible, o `std::pmr::polymorphic_allocator`.
  */
 class Lista {
     private:
+        using NodoL = Nodo<T, Asignador>;
+        using Enlace = PunteroNodo<NodoL, Asignador>;
+
+        // Crea los nodos con el asignador de la lista
+        GestorNodos<NodoL, Asignador> gestor;
         // Puntero al primer nodo de la lista
-        std::unique_ptr<Nodo<T>> cabeza;
+        Enlace cabeza;
+        // Puntero al último nodo de la lista, no es dueño del nodo; permite insertar al final sin recorrer la lista
+        NodoL* cola;
+        // Número de nodos de la lista, se actualiza en cada operación para no tener que contarlos
+        int tamano;
+
+        /**
+         * @class Iterador
+         * @brief Iterador hacia adelante sobre los elementos de la lista.
+         * Guarda un puntero al nodo actual; avanzar es seguir el puntero siguiente, en O(1).
+         * Un iterador sigue siendo válido mientras no se elimine el nodo al que apunta.
+         * @tparam U T para el iterador normal, o const T para el iterador constante.
+         */
+        template <typename U>
+        class Iterador {
+            private:
+                NodoL* actual;
+                friend class Lista;
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = T;
+                using difference_type = std::ptrdiff_t;
+                using pointer = U*;
+                using reference = U&;
+
+                explicit Iterador(NodoL* nodo = nullptr) : actual(nodo) {}
+                // Permite convertir un iterador normal en uno constante
+                Iterador(const Iterador<T>& otro) : actual(otro.actual) {}
+
+                reference operator*() const { return actual->dato; }
+                pointer operator->() const { return &actual->dato; }
+                Iterador& operator++() {
+                    actual = actual->siguiente.get();
+                    return *this;
+                }
+                Iterador operator++(int) {
+                    Iterador copia = *this;
+                    actual = actual->siguiente.get();
+                    return copia;
+                }
+                bool operator==(const Iterador& otro) const { return actual == otro.actual; }
+                bool operator!=(const Iterador& otro) const { return actual != otro.actual; }
+        };
+
     public:
-        Lista() : cabeza(nullptr) {} //Constructor que inicializa la lista vacía
+        using iterador = Iterador<T>;
+        using iteradorConstante = Iterador<const T>;
+
+        //Constructor que inicializa la lista vacía; los nodos se pedirán al asignador indicado
+        explicit Lista(const Asignador& asignador = Asignador()) : gestor(asignador), cabeza(nullptr), cola(nullptr), tamano(0) {}
+
+        /**
+         * @brief Destructor de la lista.
+         * Libera los nodos con limpiar(), de forma iterativa. Si se dejara a `std::unique_ptr` destruir la cadena,
+         * cada nodo destruiría al siguiente de forma recursiva y una lista larga desbordaría la pila.
+         */
+        ~Lista() {
+            limpiar();
+        }
+
+        Lista(const Lista&) = delete;
+        Lista& operator=(const Lista&) = delete;
+
+        /**
+         * @brief Constructor de movimiento: toma los nodos y el asignador de otra lista, que queda vacía.
+         */
+        Lista(Lista&& otra) noexcept : gestor(otra.gestor), cabeza(std::move(otra.cabeza)), cola(otra.cola), tamano(otra.tamano) {
+            otra.cola = nullptr;
+            otra.tamano = 0;
+        }
+
+        /**
+         * @brief Asignación por movimiento: libera los nodos propios y toma los de otra lista.
+         * La lista conserva su asignador; los nodos tomados vuelven al de la otra lista cuando se liberan.
+         */
+        Lista& operator=(Lista&& otra) noexcept {
+            if (this != &otra) {
+                limpiar();
+                cabeza = std::move(otra.cabeza);
+                cola = otra.cola;
+                tamano = otra.tamano;
+                otra.cola = nullptr;
+                otra.tamano = 0;
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Devuelve una copia del asignador con el que se crean los nodos.
+         */
+        Asignador obtenerAsignador() const {
+            return gestor.obtenerAsignador();
+        }
+
         /**
          * @brief Inserta un nuevo elemento al inicio de la lista.
          * @param valor El valor a insertar en la lista.
          */
         void insertarAlInicio(const T& valor) {
+            typename Instrumentacion::Temporizador medir("lista_insertar_inicio");
+            Instrumentacion::asignacion();
             //Si cabeza es nulo, significa que la lista está vacía.
             //En ese caso, cabeza apunta a un nuevo nodo con el valor, dado a que este nuevo nodo se construye con un puntero a nullptr, se vuelve la cabeza y cola de la lista.
             //Si cabeza no es nulo, significa que ya hay nodos en la lista.
             //En ese caso, creamos un nuevo nodo, se le asigna el valor y el parametro siguiente del nuevo nodo ahora sera la dirección donde apuntaba cabeza, cabeza ahora apunta al nuevo nodo.
             if(!cabeza){
-                //Envolvemos el constructor de Nodo en std::make_unique para crear un nuevo nodo con el valor proporcionado.
+                //El gestor crea, con el asignador de la lista, un nuevo nodo con el valor proporcionado.
                 //Esto asegura que el nuevo nodo se convierte en la cabeza de la lista.
-                cabeza = std::make_unique<Nodo<T>>(valor);
+                cabeza = gestor.crear(valor);
+                cola = cabeza.get(); //El único nodo es a la vez el primero y el último
             } else {
-                //Envolcemos el constructor de Nodo en std::make_unique para crear un nuevo nodo con el valor proporcionado.
+                //El gestor crea, con el asignador de la lista, un nuevo nodo con el valor proporcionado.
                 //El nuevo nodo se convierte en la cabeza de la lista, y su siguiente apunta al nodo que antes era la cabeza.
                 //Esto asegura que el nuevo nodo se convierte en el primer nodo de la lista.
                 //nuevoNodo es un puntero inteligente que apunta a un nuevo nodo con el valor proporcionado.
                 //nuevoNodo no es un nodo, es un puntero inteligente que apunta a un nodo.
-                auto nuevoNodo = std::make_unique<Nodo<T>>(valor);
+                auto nuevoNodo = gestor.crear(valor);
                 nuevoNodo->siguiente = std::move(cabeza);
                 cabeza = std::move(nuevoNodo);
             }
+            tamano++;
         }
 
         /**
@@ -56,21 +165,20 @@ class Lista {
          * @param valor El valor a insertar en la lista.
          */
         void insertarAlFinal(const T& valor) {
+            typename Instrumentacion::Temporizador medir("lista_insertar_final");
             //Si cabeza es nulo, significa que la lista está vacía.
             //En ese caso, se llama a insertarAlInicio para agregar el primer nodo.
             //Si cabeza no es nulo, significa que ya hay nodos en la lista.
-            //En ese caso, recorremos la lista hasta el último nodo y agregamos el nuevo nodo al final, el parametro siguiente del nodo al que apunta actual ahora apunta al nuevo nodo, y el nuevo nodo se construye con un puntero a nullptr.
-            //Esto asegura que el nuevo nodo se convierte en el último nodo de la lista.
+            //En ese caso, ya no recorremos la lista: el puntero cola apunta directamente al último nodo, así que enlazamos ahí el nuevo nodo en O(1).
+            //Después cola avanza al nuevo nodo, que se construye con un puntero a nullptr y se convierte en el último nodo de la lista.
             //Recuerda que el último nodo tiene su puntero siguiente apuntando a nullptr.
             if(!cabeza){
                 insertarAlInicio(valor);
             } else {
-                Nodo<T>* actual = cabeza.get();
-                while(actual->siguiente){
-                    actual = actual->siguiente.get();
-                }
-                auto nuevoNodo = std::make_unique<Nodo<T>>(valor);
-                actual->siguiente = std::move(nuevoNodo);
+                Instrumentacion::asignacion();
+                cola->siguiente = gestor.crear(valor);
+                cola = cola->siguiente.get();
+                tamano++;
             }
         }
         
@@ -82,7 +190,7 @@ class Lista {
             if (!cabeza) {
                 std::cout << "La lista está vacía.\n";
             } else {
-                Nodo<T>* actual = cabeza.get();
+                NodoL* actual = cabeza.get();
                 while (actual) {
                     std::cout << actual->dato;
                     if (actual->siguiente) {
@@ -102,6 +210,7 @@ class Lista {
          * Si la posición es inválida, no se realiza ninguna acción.
          */
         void eliminar(int posicion) {
+            typename Instrumentacion::Temporizador medir("lista_eliminar");
             if (posicion < 0 || !cabeza) {
                 std::cout << "Posición inválida o lista vacía.\n";
                 return;
@@ -109,14 +218,19 @@ class Lista {
             if (posicion == 0) {
                 // Si la posición es 0, eliminamos el nodo cabeza
                 cabeza = std::move(cabeza->siguiente);
+                if (!cabeza) {
+                    cola = nullptr; // La lista quedó vacía
+                }
+                tamano--;
                 return;
             } else {
-                Nodo<T>* actual = cabeza.get();
-                Nodo<T>* anterior = nullptr;
+                NodoL* actual = cabeza.get();
+                NodoL* anterior = nullptr;
                 int indice = 0;
 
                 // Recorremos la lista hasta encontrar la posición indicada
                 while (actual && indice < posicion) {
+                    Instrumentacion::salto();
                     anterior = actual;
                     actual = actual->siguiente.get();
                     indice++;
@@ -130,7 +244,11 @@ class Lista {
 
                 // Si encontramos el nodo a eliminar, lo eliminamos
                 if (anterior) {
+                    if (actual == cola) {
+                        cola = anterior; // Si eliminamos el último nodo, el anterior pasa a ser el último
+                    }
                     anterior->siguiente = std::move(actual->siguiente);
+                    tamano--;
                     //Ahora el atributo siguiente del nodo anterior apunta al siguiente nodo del nodo actual, eliminando automáticamente el nodo actual gracias a la gestión de memoria de std::unique_ptr.
                 }
             }
@@ -139,26 +257,42 @@ class Lista {
         /**
          * @brief Busca un elemento en la lista.
          * @param valor El valor a buscar en la lista.
+         * @return La posición del valor (0 es el primer elemento), o -1 si no se encuentra.
          * Recorre la lista desde la cabeza hasta el final, comparando cada valor con el valor buscado.
-         * Si encuentra el valor, imprime un mensaje indicando que el valor fue encontrado, de lo contrario, indica que el valor no se encuentra en la lista.
+         * No imprime nada; quien llama decide qué hacer con el resultado.
          */
-        void buscar(const T& valor){
-            Nodo<T>* actual = cabeza.get();
+        int buscar(const T& valor) const {
+            typename Instrumentacion::Temporizador medir("lista_buscar");
+            NodoL* actual = cabeza.get();
             int indice = 0;
-            //Recorremos la lista desde la cabeza hasta el final, comparando cada valor con el valor buscado.
-            //Si encontramos el valor, imprimimos un mensaje indicando que el valor fue encontrado, de lo contrario, indicamos que el valor no se encuentra en la lista.
             //El indice se incrementa en cada iteración para indicar la posición del nodo actual.
             while (actual) {
+                Instrumentacion::comparacion();
                 if (actual->dato == valor) {
-                    std::cout << "Valor " << valor << " encontrado en la posición " << indice << ".\n";
-                    return;
-                } else {
-                    actual = actual->siguiente.get();
-                    indice++;
+                    return indice;
                 }
+                Instrumentacion::salto();
+                actual = actual->siguiente.get();
+                indice++;
             }
-            //Si llegamos al final de la lista y no encontramos el valor, imprimimos un mensaje indicando que el valor no se encuentra en la lista.
-            std::cout << "Valor " << valor << " no encontrado en la lista.\n";      
+            return -1;
+        }
+
+        /**
+         * @brief Busca un elemento y devuelve un iterador a él.
+         * @param valor El valor a buscar en la lista.
+         * @return Iterador al primer nodo con el valor, o end() si no se encuentra.
+         * A diferencia de buscar(), el iterador permite seguir trabajando en ese punto sin volver a recorrer la lista.
+         */
+        iterador encontrar(const T& valor) {
+            typename Instrumentacion::Temporizador medir("lista_encontrar");
+            for (iterador it = begin(); it != end(); ++it) {
+                Instrumentacion::comparacion();
+                if (*it == valor) {
+                    return it;
+                }
+            }
+            return end();
         }
 
         /**
@@ -168,6 +302,7 @@ class Lista {
          * Recorre la lista hasta la posición indicada y añade el nuevo nodo en esa posición
          */
         void anadirEnPosicion(const T& valor, int posicion) {
+            typename Instrumentacion::Temporizador medir("lista_anadir_en_posicion");
             if (posicion < 0) {
                 std::cout << "Posición inválida.\n";
                 return;
@@ -176,19 +311,21 @@ class Lista {
                 insertarAlInicio(valor);
                 return;
             }
-            Nodo<T>* actual = cabeza.get();
-            Nodo<T>* anterior = nullptr;
+            NodoL* actual = cabeza.get();
+            NodoL* anterior = nullptr;
             int indice = 0;
 
             // Recorremos la lista hasta encontrar la posición indicada
             while (actual && indice < posicion) {
+                Instrumentacion::salto();
                 anterior = actual;
                 actual = actual->siguiente.get();
                 indice++;
             }
 
             // Creamos un nuevo nodo con el valor
-            auto nuevoNodo = std::make_unique<Nodo<T>>(valor);
+            Instrumentacion::asignacion();
+            auto nuevoNodo = gestor.crear(valor);
 
             // Si llegamos al final de la lista o la posición es válida, insertamos el nuevo nodo
             if (!anterior) {
@@ -197,8 +334,12 @@ class Lista {
             }
 
             // Enlazamos el nuevo nodo en la posición indicada
+            if (anterior == cola) {
+                cola = nuevoNodo.get(); // Si insertamos después del último nodo, el nuevo pasa a ser el último
+            }
             nuevoNodo->siguiente = std::move(anterior->siguiente);
             anterior->siguiente = std::move(nuevoNodo);
+            tamano++;
         }
 
         /**
@@ -209,10 +350,11 @@ class Lista {
          * Esta operación es útil para revertir el orden de los elementos en la lista enlazada
          */
         void invertir() {
-            std::unique_ptr<Nodo<T>> nuevaCabeza = nullptr;
+            cola = cabeza.get(); // El primer nodo será el último después de invertir
+            Enlace nuevaCabeza = nullptr;
             while (cabeza) {
                 // Tomamos el primer nodo de la lista original
-                std::unique_ptr<Nodo<T>> temp = std::move(cabeza);
+                Enlace temp = std::move(cabeza);
                 // Avanzamos la cabeza al siguiente nodo
                 cabeza = std::move(temp->siguiente);
                 // Conectamos el nodo al principio de la nueva lista
@@ -224,27 +366,246 @@ class Lista {
 
         /**
          * @brief Obtiene el tamaño de la lista.
-         * Recorre la lista y cuenta el número de nodos presentes.
+         * Devuelve el contador que mantienen las operaciones de inserción y eliminación, sin recorrer la lista.
          */
         int obtenerTamano() const {
-            int tamano = 0;
-            Nodo<T>* actual = cabeza.get();
-            while (actual) {
-                tamano++;
-                actual = actual->siguiente.get();
-            }
             return tamano;
         }
 
         /**
          * @brief Limpia la lista.
          * Elimina todos los nodos de la lista, liberando la memoria ocupada por ellos.
-         * Esto se logra al reasignar el puntero cabeza a nullptr, lo que automáticamente libera la memoria de los nodos gracias a `std::unique_ptr`.
+         * Los nodos se liberan uno por uno desde la cabeza: antes de destruir cada nodo se le quita su siguiente,
+         * así ninguna destrucción encadena a la del resto y la pila no crece con el tamaño de la lista.
          */
         void limpiar() {
-            cabeza = nullptr; // Al reasignar a nullptr, se liberan automáticamente los nodos gracias a std::unique_ptr
+            while (cabeza) {
+                // cabeza toma el siguiente nodo y el nodo anterior, ya sin sucesores, se libera solo
+                cabeza = std::move(cabeza->siguiente);
+            }
+            cola = nullptr;
+            tamano = 0;
+        }
+
+        /**
+         * @brief Iteradores al primer elemento y a la posición siguiente al último.
+         * Permiten recorrer la lista con un for de rango sin imprimirla.
+         */
+        iterador begin() { return iterador(cabeza.get()); }
+        iterador end() { return iterador(nullptr); }
+        iteradorConstante begin() const { return iteradorConstante(cabeza.get()); }
+        iteradorConstante end() const { return iteradorConstante(nullptr); }
+
+        /**
+         * @brief Iterador al último elemento de la lista, en O(1) gracias al puntero cola.
+         * @return Iterador al último nodo, o end() si la lista está vacía.
+         */
+        iterador ultimo() { return iterador(cola); }
+
+        /**
+         * @brief Inserta un nuevo elemento justo después de la posición indicada por un iterador.
+         * @param posicion Iterador a un elemento de la lista (no end()).
+         * @param valor El valor a insertar.
+         * @return Iterador al nuevo elemento.
+         * Sólo enlaza el nodo nuevo, sin recorrer la lista: O(1).
+         */
+        iterador insertarDespues(iterador posicion, const T& valor) {
+            NodoL* anterior = posicion.actual;
+            Instrumentacion::asignacion();
+            auto nuevoNodo = gestor.crear(valor);
+            NodoL* nuevoPtr = nuevoNodo.get();
+            nuevoNodo->siguiente = std::move(anterior->siguiente);
+            anterior->siguiente = std::move(nuevoNodo);
+            if (anterior == cola) {
+                cola = nuevoPtr;
+            }
+            tamano++;
+            return iterador(nuevoPtr);
+        }
+
+        /**
+         * @brief Elimina el elemento que sigue a la posición indicada por un iterador.
+         * @param posicion Iterador a un elemento de la lista (no end()).
+         * @return Iterador al elemento que quedó después de posicion, o end().
+         * Si posicion es el último elemento no hay nada que eliminar y no se realiza ninguna acción. O(1).
+         */
+        iterador eliminarDespues(iterador posicion) {
+            NodoL* anterior = posicion.actual;
+            if (!anterior->siguiente) {
+                return end();
+            }
+            if (anterior->siguiente.get() == cola) {
+                cola = anterior;
+            }
+            anterior->siguiente = std::move(anterior->siguiente->siguiente);
+            tamano--;
+            return iterador(anterior->siguiente.get());
+        }
+
+        /**
+         * @brief Mueve todos los nodos de otra lista justo después de la posición indicada.
+         * @param posicion Iterador a un elemento de esta lista (no end()).
+         * @param otra Lista cuyos nodos se trasladan; queda vacía.
+         * No se copia ni se reserva nada: sólo se reenlazan los extremos gracias a la cola de la otra lista, en O(1).
+         */
+        void empalmarDespues(iterador posicion, Lista& otra) {
+            if (this == &otra || !otra.cabeza) {
+                return;
+            }
+            NodoL* anterior = posicion.actual;
+            otra.cola->siguiente = std::move(anterior->siguiente);
+            if (anterior == cola) {
+                cola = otra.cola;
+            }
+            anterior->siguiente = std::move(otra.cabeza);
+            tamano += otra.tamano;
+            otra.cola = nullptr;
+            otra.tamano = 0;
+        }
+
+        /**
+         * @brief Añade todos los nodos de otra lista al final de ésta.
+         * @param otra Lista cuyos nodos se trasladan; queda vacía.
+         * Igual que empalmarDespues() sobre el último elemento, en O(1).
+         */
+        void concatenar(Lista& otra) {
+            if (this == &otra || !otra.cabeza) {
+                return;
+            }
+            if (!cabeza) {
+                cabeza = std::move(otra.cabeza);
+                cola = otra.cola;
+                tamano = otra.tamano;
+                otra.cola = nullptr;
+                otra.tamano = 0;
+                return;
+            }
+            empalmarDespues(ultimo(), otra);
+        }
+
+        /**
+         * @brief Ordena la lista con un merge sort ascendente (bottom-up), estable y sin recursión.
+         * @param comparar Función que devuelve true si el primer argumento va antes que el segundo.
+         * No copia datos ni reserva memoria: sólo reenlaza los nodos, en O(n log n).
+         * Cada casilla i de un arreglo fijo guarda una sublista ordenada de 2^i nodos. Cada nodo que sale de la lista
+         * se mezcla con las casillas ocupadas, como al sumar 1 en binario, y al final se mezclan todas las casillas.
+         * Con 64 casillas cabe cualquier lista que quepa en memoria.
+         */
+        template <typename Comparador = std::less<T>>
+        void ordenar(Comparador comparar = Comparador()) {
+            typename Instrumentacion::Temporizador medir("lista_ordenar");
+            if (tamano < 2) {
+                return;
+            }
+            Enlace casillas[64];
+            while (cabeza) {
+                Enlace nodo = std::move(cabeza);
+                cabeza = std::move(nodo->siguiente);
+                int i = 0;
+                // Las casillas ocupadas contienen nodos anteriores, por eso van primero en la mezcla (estabilidad)
+                while (casillas[i]) {
+                    nodo = mezclar(std::move(casillas[i]), std::move(nodo), comparar);
+                    i++;
+                }
+                casillas[i] = std::move(nodo);
+            }
+            Enlace resultado;
+            for (auto& casilla : casillas) {
+                if (casilla) {
+                    resultado = mezclar(std::move(casilla), std::move(resultado), comparar);
+                }
+            }
+            cabeza = std::move(resultado);
+            // Los nodos cambiaron de lugar: buscamos el nuevo último nodo
+            cola = cabeza.get();
+            while (cola->siguiente) {
+                cola = cola->siguiente.get();
+            }
         }
 
+        /**
+         * @brief Elimina los elementos iguales a su predecesor inmediato, como std::unique.
+         * @return Número de elementos eliminados.
+         * Después de ordenar() deja un solo ejemplar de cada valor. Recorre la lista una sola vez.
+         */
+        int eliminarDuplicadosConsecutivos() {
+            if (!cabeza) {
+                return 0;
+            }
+            int eliminados = 0;
+            NodoL* actual = cabeza.get();
+            while (actual->siguiente) {
+                if (actual->siguiente->dato == actual->dato) {
+                    actual->siguiente = std::move(actual->siguiente->siguiente);
+                    eliminados++;
+                } else {
+                    actual = actual->siguiente.get();
+                }
+            }
+            cola = actual;
+            tamano -= eliminados;
+            return eliminados;
+        }
+
+        /**
+         * @brief Elimina todos los valores repetidos conservando la primera aparición de cada uno.
+         * @return Número de elementos eliminados.
+         * Es estable: los elementos que quedan mantienen su orden original. Usa un std::unordered_set con los valores
+         * ya vistos, así que T debe poder usarse con std::hash. Recorre la lista una sola vez.
+         */
+        int eliminarDuplicados() {
+            if (!cabeza) {
+                return 0;
+            }
+            std::unordered_set<T> vistos;
+            vistos.reserve(static_cast<std::size_t>(tamano));
+            int eliminados = 0;
+            NodoL* actual = cabeza.get();
+            vistos.insert(actual->dato);
+            while (actual->siguiente) {
+                if (!vistos.insert(actual->siguiente->dato).second) {
+                    actual->siguiente = std::move(actual->siguiente->siguiente);
+                    eliminados++;
+                } else {
+                    actual = actual->siguiente.get();
+                }
+            }
+            cola = actual;
+            tamano -= eliminados;
+            return eliminados;
+        }
+
+    private:
+        /**
+         * @brief Mezcla dos sublistas ordenadas en una sola, de forma iterativa.
+         * @param a Sublista cuyos elementos estaban antes en la lista original.
+         * @param b Sublista cuyos elementos estaban después.
+         * @param comparar Criterio de orden.
+         * @return La sublista mezclada. Ante empates se toma primero de a, lo que hace estable al ordenamiento.
+         */
+        template <typename Comparador>
+        static Enlace mezclar(Enlace a, Enlace b, Comparador& comparar) {
+            Enlace resultado;
+            // destino apunta al puntero donde se enlazará el siguiente nodo elegido
+            Enlace* destino = &resultado;
+            while (a && b) {
+                Instrumentacion::comparacion();
+                if (comparar(b->dato, a->dato)) {
+                    *destino = std::move(b);
+                    b = std::move((*destino)->siguiente);
+                } else {
+                    *destino = std::move(a);
+                    a = std::move((*destino)->siguiente);
+                }
+                destino = &(*destino)->siguiente;
+            }
+            *destino = a ? std::move(a) : std::move(b);
+            return resultado;
+        }
 };
 
+/// Lista cuyos nodos se piden a un `std::pmr::memory_resource`, por ejemplo RecursoMonotono o RecursoPoolNodos.
+template <typename T, typename Instrumentacion = SinInstrumentacion>
+using ListaPmr = Lista<T, Instrumentacion, std::pmr::polymorphic_allocator<T>>;
+
 #endif
\ No newline at end of file
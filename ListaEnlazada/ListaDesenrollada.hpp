@@ -0,0 +1,289 @@
+/**
+ * @file ListaDesenrollada.hpp
+ * @brief Definición de la clase ListaDesenrollada, variante de Lista con varios elementos por nodo.
+ * Ofrece la misma interfaz que Lista, pero al agrupar los elementos en bloques contiguos
+ * los recorridos tocan una línea de caché por cada varios elementos y se hacen muchas menos reservas de memoria.
+ */
+#ifndef LISTADESENROLLADA_HPP
+#define LISTADESENROLLADA_HPP
+
+#include "NodoDesenrollado.hpp"
+#include <iostream>
+#include <utility>
+
+/**
+ * @class ListaDesenrollada
+ * @brief Lista enlazada desenrollada (unrolled linked list).
+ *
+ * Cada nodo guarda hasta N elementos. Al insertar en un nodo lleno, éste se parte en dos mitades;
+ * al eliminar, un nodo que queda vacío se descarta y dos nodos vecinos que caben en uno se fusionan.
+ * Así los nodos se mantienen razonablemente llenos y la lista conserva la localidad de un arreglo.
+ * Se guardan además el último nodo y el tamaño, por lo que insertarAlFinal y obtenerTamano cuestan O(1).
+ * @tparam T Tipo de dato almacenado; debe tener constructor por defecto.
+ * @tparam N Número de elementos por nodo; por defecto los que caben en dos líneas de caché.
+ */
+template <typename T, std::size_t N = capacidadPorNodo<T>()>
+class ListaDesenrollada {
+    private:
+        using NodoD = NodoDesenrollado<T, N>;
+
+        std::unique_ptr<NodoD> cabeza; ///< Primer nodo de la lista.
+        NodoD* ultimo;                 ///< Último nodo de la lista.
+        int tamano;                    ///< Número total de elementos.
+
+        /**
+         * @brief Parte un nodo lleno en dos, moviendo la mitad superior a un nodo nuevo que se enlaza después.
+         * @param nodo Nodo a partir.
+         */
+        void partir(NodoD* nodo) {
+            auto nuevoNodo = std::make_unique<NodoD>();
+            std::size_t mitad = nodo->cantidad / 2;
+            for (std::size_t i = mitad; i < nodo->cantidad; ++i) {
+                nuevoNodo->elementos[i - mitad] = std::move(nodo->elementos[i]);
+            }
+            nuevoNodo->cantidad = nodo->cantidad - mitad;
+            nodo->cantidad = mitad;
+            nuevoNodo->siguiente = std::move(nodo->siguiente);
+            nodo->siguiente = std::move(nuevoNodo);
+            if (ultimo == nodo) {
+                ultimo = nodo->siguiente.get();
+            }
+        }
+
+        /**
+         * @brief Inserta un valor dentro de un nodo con espacio, desplazando a la derecha los elementos posteriores.
+         * @param nodo Nodo con al menos un hueco libre.
+         * @param indice Posición dentro del nodo.
+         * @param valor Valor a insertar.
+         */
+        void insertarEnNodo(NodoD* nodo, std::size_t indice, const T& valor) {
+            for (std::size_t i = nodo->cantidad; i > indice; --i) {
+                nodo->elementos[i] = std::move(nodo->elementos[i - 1]);
+            }
+            nodo->elementos[indice] = valor;
+            nodo->cantidad++;
+            tamano++;
+        }
+
+    public:
+        ListaDesenrollada() : cabeza(nullptr), ultimo(nullptr), tamano(0) {} // Constructor que inicializa la lista vacía
+
+        /**
+         * @brief Destructor que libera los nodos de forma iterativa.
+         */
+        ~ListaDesenrollada() {
+            limpiar();
+        }
+
+        ListaDesenrollada(const ListaDesenrollada&) = delete;
+        ListaDesenrollada& operator=(const ListaDesenrollada&) = delete;
+
+        /**
+         * @brief Inserta un nuevo elemento al inicio de la lista.
+         * @param valor El valor a insertar en la lista.
+         * Si el primer nodo tiene espacio se desplazan sus elementos; si está lleno se crea un nodo nuevo como cabeza.
+         */
+        void insertarAlInicio(const T& valor) {
+            if (!cabeza || cabeza->cantidad == N) {
+                auto nuevoNodo = std::make_unique<NodoD>();
+                nuevoNodo->siguiente = std::move(cabeza);
+                cabeza = std::move(nuevoNodo);
+                if (!ultimo) {
+                    ultimo = cabeza.get();
+                }
+            }
+            insertarEnNodo(cabeza.get(), 0, valor);
+        }
+
+        /**
+         * @brief Inserta un nuevo elemento al final de la lista.
+         * @param valor El valor a insertar en la lista.
+         * Usa el puntero al último nodo, por lo que no recorre la lista.
+         */
+        void insertarAlFinal(const T& valor) {
+            if (!ultimo) {
+                insertarAlInicio(valor);
+                return;
+            }
+            if (ultimo->cantidad == N) {
+                ultimo->siguiente = std::make_unique<NodoD>();
+                ultimo = ultimo->siguiente.get();
+            }
+            insertarEnNodo(ultimo, ultimo->cantidad, valor);
+        }
+
+        /**
+         * @brief Imprime los elementos de la lista.
+         * Recorre los nodos y, dentro de cada uno, sus elementos contiguos.
+         */
+        void imprimir() const {
+            if (!cabeza) {
+                std::cout << "La lista está vacía.\n";
+                return;
+            }
+            bool primero = true;
+            for (NodoD* actual = cabeza.get(); actual; actual = actual->siguiente.get()) {
+                for (std::size_t i = 0; i < actual->cantidad; ++i) {
+                    if (!primero) {
+                        std::cout << " -> ";
+                    }
+                    std::cout << actual->elementos[i];
+                    primero = false;
+                }
+            }
+            std::cout << std::endl;
+        }
+
+        /**
+         * @brief Elimina un elemento de la lista.
+         * @param posicion La posición del elemento a eliminar (0 es el primer elemento).
+         * Se salta nodos completos restando su cantidad, sin visitar cada elemento.
+         * Si el nodo queda vacío se elimina; si cabe junto con el siguiente en un solo nodo, se fusionan.
+         */
+        void eliminar(int posicion) {
+            if (posicion < 0 || !cabeza) {
+                std::cout << "Posición inválida o lista vacía.\n";
+                return;
+            }
+            if (posicion >= tamano) {
+                std::cout << "Posición fuera de rango.\n";
+                return;
+            }
+            NodoD* anterior = nullptr;
+            NodoD* actual = cabeza.get();
+            std::size_t restante = static_cast<std::size_t>(posicion);
+            while (restante >= actual->cantidad) {
+                restante -= actual->cantidad;
+                anterior = actual;
+                actual = actual->siguiente.get();
+            }
+
+            // Desplazamos a la izquierda los elementos posteriores dentro del nodo
+            for (std::size_t i = restante; i + 1 < actual->cantidad; ++i) {
+                actual->elementos[i] = std::move(actual->elementos[i + 1]);
+            }
+            actual->cantidad--;
+            tamano--;
+
+            if (actual->cantidad == 0) {
+                // El nodo quedó vacío: lo desenlazamos
+                std::unique_ptr<NodoD>& duenio = anterior ? anterior->siguiente : cabeza;
+                if (ultimo == actual) {
+                    ultimo = anterior;
+                }
+                duenio = std::move(actual->siguiente);
+                return;
+            }
+
+            NodoD* vecino = actual->siguiente.get();
+            if (vecino && actual->cantidad + vecino->cantidad <= N / 2) {
+                // Dos nodos poco llenos: pasamos los elementos del vecino a este nodo y lo descartamos
+                for (std::size_t i = 0; i < vecino->cantidad; ++i) {
+                    actual->elementos[actual->cantidad + i] = std::move(vecino->elementos[i]);
+                }
+                actual->cantidad += vecino->cantidad;
+                if (ultimo == vecino) {
+                    ultimo = actual;
+                }
+                actual->siguiente = std::move(vecino->siguiente);
+            }
+        }
+
+        /**
+         * @brief Busca un elemento en la lista.
+         * @param valor El valor a buscar en la lista.
+         * @return La posición del valor (0 es el primer elemento), o -1 si no se encuentra.
+         */
+        int buscar(const T& valor) const {
+            int base = 0;
+            for (NodoD* actual = cabeza.get(); actual; actual = actual->siguiente.get()) {
+                for (std::size_t i = 0; i < actual->cantidad; ++i) {
+                    if (actual->elementos[i] == valor) {
+                        return base + static_cast<int>(i);
+                    }
+                }
+                base += static_cast<int>(actual->cantidad);
+            }
+            return -1;
+        }
+
+        /**
+         * @brief Añade un elemento en la posición indicada.
+         * @param valor El valor a añadir en la lista.
+         * @param posicion La posición donde se añadirá el nuevo elemento (0 es el primer elemento).
+         * Si el nodo que contiene la posición está lleno, se parte en dos antes de insertar.
+         */
+        void anadirEnPosicion(const T& valor, int posicion) {
+            if (posicion < 0) {
+                std::cout << "Posición inválida.\n";
+                return;
+            }
+            if (posicion == 0) {
+                insertarAlInicio(valor);
+                return;
+            }
+            if (posicion > tamano) {
+                std::cout << "Posición fuera de rango.\n";
+                return;
+            }
+            if (posicion == tamano) {
+                insertarAlFinal(valor);
+                return;
+            }
+            NodoD* actual = cabeza.get();
+            std::size_t restante = static_cast<std::size_t>(posicion);
+            while (restante >= actual->cantidad) {
+                restante -= actual->cantidad;
+                actual = actual->siguiente.get();
+            }
+            if (actual->cantidad == N) {
+                partir(actual);
+                if (restante > actual->cantidad) {
+                    restante -= actual->cantidad;
+                    actual = actual->siguiente.get();
+                }
+            }
+            insertarEnNodo(actual, restante, valor);
+        }
+
+        /**
+         * @brief Invertir el orden de los elementos en la lista.
+         * Invierte el orden de los nodos igual que Lista::invertir y, además, el orden de los elementos dentro de cada nodo.
+         */
+        void invertir() {
+            ultimo = cabeza.get();
+            std::unique_ptr<NodoD> nuevaCabeza = nullptr;
+            while (cabeza) {
+                std::unique_ptr<NodoD> temp = std::move(cabeza);
+                cabeza = std::move(temp->siguiente);
+                for (std::size_t i = 0, j = temp->cantidad; i + 1 < j; ++i, --j) {
+                    std::swap(temp->elementos[i], temp->elementos[j - 1]);
+                }
+                temp->siguiente = std::move(nuevaCabeza);
+                nuevaCabeza = std::move(temp);
+            }
+            cabeza = std::move(nuevaCabeza);
+        }
+
+        /**
+         * @brief Obtiene el tamaño de la lista.
+         * El tamaño se mantiene actualizado en cada operación, por lo que no se recorre la lista.
+         */
+        int obtenerTamano() const {
+            return tamano;
+        }
+
+        /**
+         * @brief Limpia la lista.
+         * Libera los nodos uno por uno, de modo que ninguna destrucción encadena a la siguiente.
+         */
+        void limpiar() {
+            while (cabeza) {
+                cabeza = std::move(cabeza->siguiente);
+            }
+            ultimo = nullptr;
+            tamano = 0;
+        }
+};
+
+#endif
@@ -3,10 +3,12 @@
  * @brief Programa principal que utiliza la clase Lista.
  * Este programa crea una lista enlazada, inserta elementos, los busca, los elimina y muestra la lista en diferentes estados.
  * Utiliza la clase Lista definida en Lista.hpp y la clase Nodo definida en Nodo.hpp.
+ * Al final repite las mismas operaciones con ListaDesenrollada, que guarda varios elementos por nodo.
  */
 #include<iostream>
 #include "Nodo.hpp"
 #include "Lista.hpp"
+#include "ListaDesenrollada.hpp"
 
 int main() {
     Lista<int> lista;
@@ -28,9 +30,15 @@ int main() {
     std::cout << "Lista después de insertar al final: ";
     lista.imprimir();
 
-    // Buscar un elemento
-    lista.buscar(20);
-    lista.buscar(60);
+    // Buscar un elemento: buscar devuelve la posición o -1, sin imprimir
+    for (int valor : {20, 60}) {
+        int posicion = lista.buscar(valor);
+        if (posicion >= 0) {
+            std::cout << "Valor " << valor << " encontrado en la posición " << posicion << ".\n";
+        } else {
+            std::cout << "Valor " << valor << " no encontrado en la lista.\n";
+        }
+    }
 
     // Añadir en una posición específica
     lista.anadirEnPosicion(25, 1);
@@ -52,6 +60,38 @@ int main() {
     //Obtener el tamaño de la lista
     std::cout << "Tamaño de la lista: " << lista.obtenerTamano() << std::endl;
 
+    // Recorrer la lista con iteradores
+    std::cout << "Recorrido con iteradores: ";
+    for (int valor : lista) {
+        std::cout << valor << " ";
+    }
+    std::cout << std::endl;
+
+    // Insertar y eliminar después de un iterador sin volver a recorrer la lista
+    Lista<int>::iterador it = lista.encontrar(10);
+    lista.insertarDespues(it, 15);
+    lista.eliminarDespues(lista.begin());
+    std::cout << "Después de insertar 15 tras el 10 y eliminar el segundo elemento: ";
+    lista.imprimir();
+
+    // Concatenar otra lista en O(1)
+    Lista<int> otra;
+    otra.insertarAlFinal(60);
+    otra.insertarAlFinal(70);
+    lista.concatenar(otra);
+    std::cout << "Después de concatenar [60, 70]: ";
+    lista.imprimir();
+
+    // Ordenar la lista y quitar duplicados sin copiarla a un vector
+    lista.insertarAlFinal(15);
+    lista.insertarAlInicio(70);
+    lista.ordenar();
+    std::cout << "Después de ordenar: ";
+    lista.imprimir();
+    lista.eliminarDuplicadosConsecutivos();
+    std::cout << "Después de eliminar duplicados: ";
+    lista.imprimir();
+
     // Limpiar la lista
     lista.limpiar();
 
@@ -59,5 +99,28 @@ int main() {
     std::cout << "Lista después de limpiar: ";
     lista.imprimir();
 
+    // La lista desenrollada ofrece la misma interfaz; con 4 elementos por nodo se ven las particiones y fusiones
+    ListaDesenrollada<int, 4> desenrollada;
+    for (int i = 1; i <= 10; ++i) {
+        desenrollada.insertarAlFinal(i * 10);
+    }
+    desenrollada.insertarAlInicio(5);
+    std::cout << "Lista desenrollada: ";
+    desenrollada.imprimir();
+
+    desenrollada.anadirEnPosicion(25, 3);
+    std::cout << "Después de añadir 25 en la posición 3: ";
+    desenrollada.imprimir();
+
+    desenrollada.eliminar(0);
+    std::cout << "Después de eliminar la posición 0: ";
+    desenrollada.imprimir();
+
+    std::cout << "Posición de 70 en la lista desenrollada: " << desenrollada.buscar(70) << std::endl;
+    desenrollada.invertir();
+    std::cout << "Lista desenrollada invertida: ";
+    desenrollada.imprimir();
+    std::cout << "Tamaño de la lista desenrollada: " << desenrollada.obtenerTamano() << std::endl;
+
     return 0;
 }
\ No newline at end of file
@@ -7,9 +7,10 @@
 #ifndef NODO_HPP
 #define NODO_HPP
 
+#include "../Memoria/GestorNodos.hpp"
 #include <memory>
 
-template <typename T>
+template <typename T, typename Asignador = std::allocator<T>>
 
 /**
  * @class Nodo
@@ -18,11 +19,12 @@ template <typename T>
  * Utiliza `std::unique_ptr` para gestionar la memoria del siguiente nodo,
  * lo que evita fugas de memoria y facilita la gestión de la lista enlazada.
  * @tparam T Tipo de dato almacenado en el nodo.
+ * @tparam Asignador Asignador con el que la lista crea sus nodos; el enlace lo usa para liberar el siguiente nodo.
  */
 class Nodo {
     public:
         T dato;
-        std::unique_ptr<Nodo<T>> siguiente;
+        PunteroNodo<Nodo<T, Asignador>, Asignador> siguiente;
         Nodo(const T& valor) : dato(valor), siguiente(nullptr) {}
 };
 #endif
\ No newline at end of file
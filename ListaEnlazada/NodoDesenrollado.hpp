@@ -0,0 +1,44 @@
+/**
+ * @file NodoDesenrollado.hpp
+ * @brief Definición de la clase NodoDesenrollado para una lista enlazada desenrollada.
+ * Cada nodo guarda varios elementos contiguos en lugar de uno solo.
+ * Utiliza punteros inteligentes para manejar la memoria de manera segura.
+ */
+#ifndef NODODESENROLLADO_HPP
+#define NODODESENROLLADO_HPP
+
+#include <array>
+#include <cstddef>
+#include <memory>
+
+/**
+ * @brief Calcula cuántos elementos de tipo T caben en un nodo de dos líneas de caché (128 bytes).
+ * Se descuenta el espacio del contador de elementos y del puntero al siguiente nodo.
+ * @tparam T Tipo de dato almacenado.
+ * @return Capacidad del nodo, al menos 1.
+ */
+template <typename T>
+constexpr std::size_t capacidadPorNodo() {
+    return (128 - sizeof(std::size_t) - sizeof(void*)) / sizeof(T) > 0
+               ? (128 - sizeof(std::size_t) - sizeof(void*)) / sizeof(T)
+               : 1;
+}
+
+/**
+ * @class NodoDesenrollado
+ * @brief Clase que representa un nodo de una lista desenrollada.
+ * Contiene un arreglo de hasta N elementos, cuántos de ellos están ocupados y un puntero al siguiente nodo.
+ * El nodo se alinea a una línea de caché para que recorrer sus elementos no cruce más líneas de las necesarias.
+ * @tparam T Tipo de dato almacenado; debe tener constructor por defecto.
+ * @tparam N Número máximo de elementos por nodo.
+ */
+template <typename T, std::size_t N>
+class alignas(64) NodoDesenrollado {
+    public:
+        std::array<T, N> elementos;
+        std::size_t cantidad;
+        std::unique_ptr<NodoDesenrollado<T, N>> siguiente;
+        NodoDesenrollado() : elementos(), cantidad(0), siguiente(nullptr) {}
+};
+
+#endif
@@ -0,0 +1,192 @@
+/**
+ * @file BufferCircular.hpp
+ * @brief Definición de la clase BufferCircular, un anillo de capacidad fija sobre memoria contigua.
+ * @tparam T Tipo de dato almacenado.
+ * @tparam N Capacidad del anillo, potencia de dos.
+ * @details Es la versión acotada de ListaCircular para usarla como ventana deslizante: en lugar de un nodo por elemento,
+ * los datos viven en un std::array y al llenarse cada inserción sobrescribe al elemento más antiguo.
+ * Insertar nunca reserva memoria y cuesta O(1).
+ */
+
+#ifndef BUFFERCIRCULAR_HPP
+#define BUFFERCIRCULAR_HPP
+
+#include <array>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+template <typename T, std::size_t N>
+class BufferCircular {
+    static_assert(N > 0 && (N & (N - 1)) == 0, "La capacidad del BufferCircular debe ser una potencia de dos.");
+
+private:
+    static constexpr std::size_t MASCARA = N - 1; ///< Con N potencia de dos, i & MASCARA equivale a i % N.
+
+    std::array<T, N> datos{};
+    std::size_t escritos = 0; ///< Total de inserciones; la siguiente se escribe en escritos & MASCARA.
+
+    /**
+     * @brief Recorre los últimos k elementos como, a lo sumo, dos tramos contiguos del arreglo.
+     * @param k Número de elementos, entre 1 y tamano().
+     * @param funcion Se llama con cada elemento, del más antiguo al más nuevo.
+     * Dividir en tramos evita la máscara dentro del ciclo, lo que permite al compilador vectorizarlo.
+     */
+    template <typename Funcion>
+    void recorrerUltimos(std::size_t k, Funcion funcion) const {
+        std::size_t inicio = (escritos - k) & MASCARA;
+        std::size_t primerTramo = N - inicio < k ? N - inicio : k;
+        for (std::size_t i = inicio; i < inicio + primerTramo; ++i) {
+            funcion(datos[i]);
+        }
+        for (std::size_t i = 0; i < k - primerTramo; ++i) {
+            funcion(datos[i]);
+        }
+    }
+
+    /**
+     * @brief Valida el tamaño de una ventana.
+     * @throws std::out_of_range Si k es 0 o mayor que el número de elementos.
+     */
+    void validarVentana(std::size_t k) const {
+        if (k == 0 || k > tamano()) {
+            throw std::out_of_range("La ventana debe tener entre 1 y tamano() elementos.");
+        }
+    }
+
+public:
+    /**
+     * @brief Iterador constante del elemento más antiguo al más nuevo.
+     */
+    class Iterador {
+    private:
+        const BufferCircular* buffer;
+        std::size_t indice; ///< Número de inserción del elemento, no su posición en el arreglo.
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        Iterador(const BufferCircular* b, std::size_t i) : buffer(b), indice(i) {}
+        reference operator*() const { return buffer->datos[indice & MASCARA]; }
+        pointer operator->() const { return &**this; }
+        Iterador& operator++() { ++indice; return *this; }
+        Iterador operator++(int) { Iterador copia = *this; ++indice; return copia; }
+        bool operator==(const Iterador& otro) const { return indice == otro.indice; }
+        bool operator!=(const Iterador& otro) const { return indice != otro.indice; }
+    };
+
+    /**
+     * @brief Inserta un valor como el más nuevo; si el anillo está lleno, sobrescribe al más antiguo.
+     * @param valor Valor a insertar.
+     */
+    void insertar(const T& valor) {
+        datos[escritos & MASCARA] = valor;
+        ++escritos;
+    }
+
+    /**
+     * @brief Iteradores del elemento más antiguo al más nuevo.
+     */
+    Iterador begin() const { return Iterador(this, escritos - tamano()); }
+    Iterador end() const { return Iterador(this, escritos); }
+
+    /**
+     * @brief Acceso por antigüedad.
+     * @param i 0 es el elemento más antiguo y tamano() - 1 el más nuevo.
+     */
+    const T& operator[](std::size_t i) const {
+        return datos[(escritos - tamano() + i) & MASCARA];
+    }
+
+    /**
+     * @brief Devuelve el elemento más nuevo.
+     * @throws std::runtime_error Si el anillo está vacío.
+     */
+    const T& ultimo() const {
+        if (escritos == 0) {
+            throw std::runtime_error("El buffer circular está vacío.");
+        }
+        return datos[(escritos - 1) & MASCARA];
+    }
+
+    std::size_t tamano() const { return escritos < N ? escritos : N; } ///< Elementos guardados.
+    static constexpr std::size_t capacidad() { return N; }             ///< Capacidad fija.
+    bool estaVacia() const { return escritos == 0; }
+    bool estaLleno() const { return escritos >= N; }
+    std::size_t totalInsertados() const { return escritos; }           ///< Inserciones desde el inicio, incluidas las sobrescritas.
+
+    /**
+     * @brief Vacía el anillo sin liberar memoria.
+     */
+    void limpiar() {
+        escritos = 0;
+    }
+
+    /**
+     * @brief Suma de los últimos k elementos.
+     * @param k Tamaño de la ventana.
+     * @return La suma, acumulada en double para flotantes, en unsigned long long para enteros sin signo y en long long
+     * para los demás enteros, para no desbordar T.
+     * @throws std::out_of_range Si k es 0 o mayor que tamano().
+     */
+    auto suma(std::size_t k) const {
+        validarVentana(k);
+        using Acumulador = typename std::conditional<
+            std::is_floating_point<T>::value, double,
+            typename std::conditional<std::is_unsigned<T>::value, unsigned long long, long long>::type>::type;
+        Acumulador total = 0;
+        recorrerUltimos(k, [&total](const T& v) { total += v; });
+        return total;
+    }
+
+    /**
+     * @brief Promedio de los últimos k elementos.
+     * @throws std::out_of_range Si k es 0 o mayor que tamano().
+     */
+    double promedio(std::size_t k) const {
+        return static_cast<double>(suma(k)) / static_cast<double>(k);
+    }
+
+    /**
+     * @brief Mínimo de los últimos k elementos.
+     * @throws std::out_of_range Si k es 0 o mayor que tamano().
+     */
+    T minimo(std::size_t k) const {
+        validarVentana(k);
+        T resultado = (*this)[tamano() - k];
+        recorrerUltimos(k, [&resultado](const T& v) { resultado = v < resultado ? v : resultado; });
+        return resultado;
+    }
+
+    /**
+     * @brief Máximo de los últimos k elementos.
+     * @throws std::out_of_range Si k es 0 o mayor que tamano().
+     */
+    T maximo(std::size_t k) const {
+        validarVentana(k);
+        T resultado = (*this)[tamano() - k];
+        recorrerUltimos(k, [&resultado](const T& v) { resultado = resultado < v ? v : resultado; });
+        return resultado;
+    }
+
+    /**
+     * @brief Muestra los elementos del más antiguo al más nuevo.
+     */
+    void mostrar() const {
+        if (estaVacia()) {
+            std::cout << "Buffer vacío.\n";
+            return;
+        }
+        for (const T& valor : *this) {
+            std::cout << valor << " -> ";
+        }
+        std::cout << "(más nuevo)\n";
+    }
+};
+
+#endif
@@ -0,0 +1,172 @@
+/**
+ * @file Despachador.hpp
+ * @brief Definición de la clase Despachador, un reparto round-robin ponderado sobre ListaCircular.
+ * @tparam Id Tipo del identificador de cada miembro (por ejemplo, el id de un trabajador).
+ * @tparam Hash Función hash para los identificadores.
+ * @details Los miembros forman un anillo en una ListaCircular y el cursor de la lista indica a quién le toca.
+ * El reparto sigue deficit round robin: al llegar el turno de un miembro se le abona su peso como crédito
+ * y atiende pedidos mientras el crédito alcance para su costo; después el cursor avanza.
+ * Con costo 1 y pesos enteros, cada miembro recibe exactamente su peso en pedidos por vuelta.
+ */
+
+#ifndef DESPACHADOR_HPP
+#define DESPACHADOR_HPP
+
+#include "ListaCircular.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <unordered_map>
+
+/**
+ * @brief Contadores de un miembro del despachador.
+ */
+struct EstadisticasMiembro {
+    std::uint64_t peso = 0;         ///< Crédito que recibe en cada turno.
+    std::uint64_t deficit = 0;      ///< Crédito acumulado aún sin gastar.
+    std::uint64_t despachados = 0;  ///< Pedidos asignados al miembro.
+    std::uint64_t costoTotal = 0;   ///< Suma de los costos de esos pedidos.
+};
+
+template <typename Id, typename Hash = std::hash<Id>>
+class Despachador {
+private:
+    struct Miembro {
+        EstadisticasMiembro datos;
+        bool retirado = false; ///< Sigue en el anillo hasta que el cursor pase por él.
+    };
+
+    ListaCircular<Id> anillo;                      ///< Orden de turnos; el actual es el nodo del cursor.
+    std::unordered_map<Id, Miembro, Hash> miembros; ///< Pesos y contadores de cada miembro del anillo.
+    std::size_t activos = 0;
+    bool turnoAbierto = false;                     ///< Si el miembro actual ya recibió el crédito de este turno.
+    std::uint64_t totalDespachados = 0;
+
+public:
+    /**
+     * @brief Agrega un miembro al final de la vuelta, en O(1).
+     * @param id Identificador del miembro.
+     * @param peso Crédito por turno; debe ser mayor que 0.
+     * @return false si el miembro ya estaba activo; en ese caso no se modifica.
+     * @throws std::invalid_argument Si el peso es 0.
+     */
+    bool agregar(const Id& id, std::uint64_t peso = 1) {
+        if (peso == 0) {
+            throw std::invalid_argument("El peso de un miembro debe ser mayor que 0.");
+        }
+        auto it = miembros.find(id);
+        if (it != miembros.end()) {
+            if (!it->second.retirado) {
+                return false;
+            }
+            // Se retiró pero el cursor aún no lo quitaba del anillo: se reactiva en su lugar
+            it->second = Miembro{};
+        } else {
+            it = miembros.emplace(id, Miembro{}).first;
+            anillo.insertar(id);
+        }
+        it->second.datos.peso = peso;
+        activos++;
+        return true;
+    }
+
+    /**
+     * @brief Retira un miembro, en O(1).
+     * @param id Identificador del miembro.
+     * @return false si no estaba activo.
+     * El nodo se marca y se quita del anillo cuando el cursor llega a él, así no hace falta buscarlo.
+     */
+    bool retirar(const Id& id) {
+        auto it = miembros.find(id);
+        if (it == miembros.end() || it->second.retirado) {
+            return false;
+        }
+        it->second.retirado = true;
+        activos--;
+        return true;
+    }
+
+    /**
+     * @brief Cambia el peso de un miembro activo; se aplica desde su siguiente turno.
+     * @return false si el miembro no está activo.
+     * @throws std::invalid_argument Si el peso es 0.
+     */
+    bool cambiarPeso(const Id& id, std::uint64_t peso) {
+        if (peso == 0) {
+            throw std::invalid_argument("El peso de un miembro debe ser mayor que 0.");
+        }
+        auto it = miembros.find(id);
+        if (it == miembros.end() || it->second.retirado) {
+            return false;
+        }
+        it->second.datos.peso = peso;
+        return true;
+    }
+
+    /**
+     * @brief Elige al miembro que atiende el siguiente pedido.
+     * @param costo Costo del pedido, por ejemplo su tamaño en bytes.
+     * @return Identificador del miembro elegido.
+     * @throws std::runtime_error Si no hay miembros activos.
+     * Con costos no mayores que los pesos cuesta O(1) amortizado; un costo mayor hace que los miembros
+     * acumulen crédito durante varias vueltas antes de poder atenderlo.
+     */
+    Id siguiente(std::uint64_t costo = 1) {
+        if (activos == 0) {
+            throw std::runtime_error("El despachador no tiene miembros activos.");
+        }
+        while (true) {
+            auto it = miembros.find(anillo.actual());
+            if (it->second.retirado) {
+                miembros.erase(it);
+                anillo.eliminarEnCursor();
+                turnoAbierto = false;
+                continue;
+            }
+            EstadisticasMiembro& datos = it->second.datos;
+            if (!turnoAbierto) {
+                datos.deficit += datos.peso;
+                turnoAbierto = true;
+            }
+            if (datos.deficit >= costo) {
+                datos.deficit -= costo;
+                datos.despachados++;
+                datos.costoTotal += costo;
+                totalDespachados++;
+                return it->first;
+            }
+            anillo.avanzar();
+            turnoAbierto = false;
+        }
+    }
+
+    /**
+     * @brief Devuelve los contadores de un miembro activo, o nullptr si no lo está.
+     */
+    const EstadisticasMiembro* estadisticas(const Id& id) const {
+        auto it = miembros.find(id);
+        if (it == miembros.end() || it->second.retirado) {
+            return nullptr;
+        }
+        return &it->second.datos;
+    }
+
+    bool contiene(const Id& id) const { return estadisticas(id) != nullptr; }
+    std::size_t tamano() const { return activos; }               ///< Miembros activos.
+    bool estaVacio() const { return activos == 0; }
+    std::uint64_t despachados() const { return totalDespachados; } ///< Pedidos asignados en total.
+
+    /**
+     * @brief Retira a todos los miembros y reinicia los contadores.
+     */
+    void limpiar() {
+        anillo.limpiar();
+        miembros.clear();
+        activos = 0;
+        turnoAbierto = false;
+        totalDespachados = 0;
+    }
+};
+
+#endif
@@ -3,45 +3,136 @@
  * @brief Definición de la clase ListaCircular para una lista enlazada circular.
  * @tparam T Tipo de dato almacenado en la lista.
  * @details Esta clase implementa una lista enlazada circular utilizando nodos definidos por la estructura
- * Nodo. Permite insertar, mostrar, eliminar nodos y buscar posiciones de valores.
+ * NodoCircular. Permite insertar, mostrar, eliminar nodos y buscar posiciones de valores.
  * Utiliza punteros únicos para la gestión automática de memoria.
+ * Cada nodo es dueño del siguiente, desde la cabeza hasta el último; el enlace que cierra el anillo
+ * (del último nodo de vuelta a la cabeza) no es dueño, así ningún nodo se posee a sí mismo ni se libera dos veces.
+ * Un cursor giratorio permite recorrer el anillo e insertar o eliminar junto a él en O(1), como en un despachador round-robin.
+ * Los nodos se crean con un asignador configurable (`std::allocator` o compatible, o `std::pmr::polymorphic_allocator`).
  */
 
 #ifndef LISTACIRCULAR_HPP
 #define LISTACIRCULAR_HPP
 
 #include <memory>
+#include <memory_resource>
 #include <iostream>
-#include "Nodo.hpp"
+#include <stdexcept>
+#include "NodoCircular.hpp"
 
-template <typename T>
+template <typename T, typename Asignador = std::allocator<T>>
 class ListaCircular {
 private:
-    std::unique_ptr<Nodo<T>> cabeza;
-    Nodo<T>* ultimo = nullptr;
+    using NodoL = NodoCircular<T, Asignador>;
+
+    GestorNodos<NodoL, Asignador> gestor;
+    PunteroNodo<NodoL, Asignador> cabeza;
+    NodoL* ultimo = nullptr;
+    // El cursor se guarda como el nodo anterior al actual: así eliminar el nodo actual también cuesta O(1)
+    NodoL* previoCursor = nullptr;
+    int tamano = 0;
+
+    /**
+     * @brief Devuelve el nodo que sigue a otro dentro del anillo.
+     * @param nodo Nodo de la lista.
+     * El último nodo no guarda puntero dueño a la cabeza: su siguiente está vacío y el anillo se cierra aquí.
+     */
+    NodoL* siguienteDe(NodoL* nodo) const {
+        return nodo->siguiente ? nodo->siguiente.get() : cabeza.get();
+    }
+
+    /**
+     * @brief Inserta un nuevo nodo inmediatamente después de otro, en O(1).
+     * @param nodo Nodo tras el cual insertar, o nullptr si la lista está vacía.
+     * @param valor Valor del nuevo nodo.
+     * @return Puntero al nodo creado.
+     * Si se inserta justo después del anterior al cursor, éste se ajusta para que el nodo actual no cambie.
+     */
+    NodoL* insertarDespuesDeNodo(NodoL* nodo, const T& valor) {
+        auto nuevo = gestor.crear(valor);
+        NodoL* nuevoPtr = nuevo.get();
+        if (!nodo) {
+            // Primer nodo: es la cabeza, el último y el actual del cursor
+            cabeza = std::move(nuevo);
+            ultimo = nuevoPtr;
+            previoCursor = nuevoPtr;
+            tamano = 1;
+            return nuevoPtr;
+        }
+        nuevo->siguiente = std::move(nodo->siguiente); // Si nodo es el último, queda vacío: el nuevo pasa a cerrar el anillo
+        nodo->siguiente = std::move(nuevo);
+        if (nodo == ultimo) {
+            ultimo = nuevoPtr;
+        }
+        if (nodo == previoCursor) {
+            previoCursor = nuevoPtr;
+        }
+        tamano++;
+        return nuevoPtr;
+    }
+
+    /**
+     * @brief Elimina el nodo que sigue a otro dentro del anillo, en O(1).
+     * @param anterior Nodo anterior al que se elimina.
+     * Si el eliminado es el anterior al cursor, el cursor retrocede a su anterior para que el nodo actual no cambie.
+     */
+    void eliminarSiguienteDe(NodoL* anterior) {
+        NodoL* victima = siguienteDe(anterior);
+        if (victima == anterior) {
+            // Solo hay un nodo
+            cabeza.reset();
+            ultimo = nullptr;
+            previoCursor = nullptr;
+            tamano = 0;
+            return;
+        }
+        if (victima == previoCursor) {
+            previoCursor = anterior;
+        }
+        if (victima == cabeza.get()) {
+            // anterior es el último: la cabeza avanza y el último pasa a cerrar el anillo hacia ella
+            cabeza = std::move(cabeza->siguiente);
+        } else {
+            if (victima == ultimo) {
+                ultimo = anterior;
+            }
+            anterior->siguiente = std::move(victima->siguiente);
+        }
+        tamano--;
+    }
 
 public:
+    ListaCircular() = default;
 
     /**
-     * @brief Constructor de la lista circular.
-     * Inicializa la lista como vacía.
-     * @param valor Valor inicial para el nodo, si se desea agregar uno al crear la lista.
+     * @brief Crea una lista vacía cuyos nodos se pedirán al asignador indicado.
      */
-    void insertar(const T& valor) {
-    auto nuevo = std::make_unique<Nodo<T>>(valor);
+    explicit ListaCircular(const Asignador& asignador) : gestor(asignador) {}
 
-    if (!cabeza) {
-        // Primer nodo
-        cabeza = std::move(nuevo);
-        cabeza->siguiente.reset(cabeza.get());  // se apunta a sí mismo
-        ultimo = cabeza.get();                  // actualizamos puntero al último nodo
-    } else {
-        nuevo->siguiente.reset(cabeza.get());   // apunta al inicio
-        ultimo->siguiente = std::move(nuevo);   // último apunta al nuevo
-        ultimo = ultimo->siguiente.get();       // actualizamos último nodo
+    /**
+     * @brief Destructor que libera los nodos de forma iterativa.
+     */
+    ~ListaCircular() {
+        limpiar();
     }
-}
 
+    ListaCircular(const ListaCircular&) = delete;
+    ListaCircular& operator=(const ListaCircular&) = delete;
+
+    /**
+     * @brief Devuelve una copia del asignador con el que se crean los nodos.
+     */
+    Asignador obtenerAsignador() const {
+        return gestor.obtenerAsignador();
+    }
+
+    /**
+     * @brief Inserta un nuevo nodo al final de la lista, justo antes de la cabeza en el anillo.
+     * @param valor Valor del nuevo nodo.
+     */
+    void insertar(const T& valor) {
+        insertarDespuesDeNodo(ultimo, valor);
+    }
 
     /**
      * @brief Muestra los elementos de la lista circular.
@@ -53,12 +144,11 @@ public:
             return;
         }
 
-        Nodo<T>* actual = cabeza.get();
         for (int i = 0; i < repeticiones; ++i) {
-            Nodo<T>* temp = actual;
+            NodoL* temp = cabeza.get();
             do {
                 std::cout << temp->dato << " -> ";
-                temp = temp->siguiente.get();
+                temp = siguienteDe(temp);
             } while (temp != cabeza.get());
             std::cout << "(repite)\n";
         }
@@ -69,85 +159,142 @@ public:
      * @param valor Valor del nodo a eliminar.
      */
     void eliminar(const T& valor) {
-    if (!cabeza) return;
-
-    Nodo<T>* actual = cabeza.get();
-    Nodo<T>* anterior = nullptr;
-
-    do {
-        if (actual->dato == valor) {
-            if (actual == cabeza.get()) {
-                // Eliminar la cabeza
-                if (actual->siguiente.get() == cabeza.get()) {
-                    // Solo hay un nodo
-                    cabeza.reset();
-                    ultimo = nullptr;
-                } else {
-                    // Hay más de un nodo
-                    ultimo->siguiente = std::move(actual->siguiente);
-                    cabeza = std::move(ultimo->siguiente);
-                }
-            } else {
-                // Nodo intermedio o final
-                anterior->siguiente = std::move(actual->siguiente);
-                if (actual == ultimo) {
-                    ultimo = anterior;
-                }
+        if (!cabeza) return;
+
+        NodoL* anterior = ultimo;
+        NodoL* actual = cabeza.get();
+        do {
+            if (actual->dato == valor) {
+                eliminarSiguienteDe(anterior);
+                return;
             }
-            return;
-        }
-        anterior = actual;
-        actual = actual->siguiente.get();
-    } while (actual != cabeza.get());
-}
+            anterior = actual;
+            actual = siguienteDe(actual);
+        } while (actual != cabeza.get());
+    }
 
-/**
- * @brief Inserta un nuevo nodo después de un nodo con un valor específico.
- * @param valorExistente Valor del nodo después del cual se insertará el nuevo nodo.
- * @param nuevoValor Valor del nuevo nodo a insertar.
- */
-void insertarDespuesDe(const T& valorExistente, const T& nuevoValor) {
-    if (!cabeza) return;
+    /**
+     * @brief Inserta un nuevo nodo después de un nodo con un valor específico.
+     * @param valorExistente Valor del nodo después del cual se insertará el nuevo nodo.
+     * @param nuevoValor Valor del nuevo nodo a insertar.
+     */
+    void insertarDespuesDe(const T& valorExistente, const T& nuevoValor) {
+        if (!cabeza) return;
 
-    Nodo<T>* actual = cabeza.get();
+        NodoL* actual = cabeza.get();
+        do {
+            if (actual->dato == valorExistente) {
+                insertarDespuesDeNodo(actual, nuevoValor);
+                return;
+            }
+            actual = siguienteDe(actual);
+        } while (actual != cabeza.get());
+    }
 
-    do {
-        if (actual->dato == valorExistente) {
-            auto nuevoNodo = std::make_unique<Nodo<T>>(nuevoValor);
-            nuevoNodo->siguiente = std::move(actual->siguiente);
-            actual->siguiente = std::move(nuevoNodo);
+    /**
+     * @brief Busca la posición de un valor en la lista circular.
+     * @param valor Valor a buscar.
+     * @return La posición del valor en la lista, o -1 si no se encuentra.
+     */
+    int buscarPosicion(const T& valor) const {
+        if (!cabeza) return -1;
 
-            if (actual == ultimo) {
-                ultimo = actual->siguiente.get();
+        NodoL* actual = cabeza.get();
+        int posicion = 0;
+        do {
+            if (actual->dato == valor) {
+                return posicion;
             }
-            return;
-        }
-        actual = actual->siguiente.get();
-    } while (actual != cabeza.get());
-}
+            actual = siguienteDe(actual);
+            posicion++;
+        } while (actual != cabeza.get());
 
-/**
- * @brief Busca la posición de un valor en la lista circular.
- * @param valor Valor a buscar.
- * @return La posición del valor en la lista, o -1 si no se encuentra.
- */
-int buscarPosicion(const T& valor) const {
-    if (!cabeza) return -1;
+        return -1; // No encontrado
+    }
+
+    /**
+     * @brief Devuelve el valor del nodo en el cursor.
+     * @throws std::runtime_error Si la lista está vacía.
+     */
+    T& actual() {
+        if (!cabeza) {
+            throw std::runtime_error("La lista circular está vacía. No hay nodo en el cursor.");
+        }
+        return siguienteDe(previoCursor)->dato;
+    }
 
-    Nodo<T>* actual = cabeza.get();
-    int posicion = 0;
+    const T& actual() const {
+        return const_cast<ListaCircular*>(this)->actual();
+    }
 
-    do {
-        if (actual->dato == valor) {
-            return posicion;
+    /**
+     * @brief Avanza el cursor al siguiente nodo del anillo.
+     * @param pasos Número de nodos a avanzar; cada paso cuesta O(1).
+     */
+    void avanzar(int pasos = 1) {
+        if (!cabeza) return;
+        for (int i = 0; i < pasos; ++i) {
+            previoCursor = siguienteDe(previoCursor);
         }
-        actual = actual->siguiente.get();
-        posicion++;
-    } while (actual != cabeza.get());
+    }
 
-    return -1; // No encontrado
-}
+    /**
+     * @brief Inserta un nuevo nodo justo después del nodo del cursor, en O(1).
+     * @param valor Valor del nuevo nodo.
+     * Si la lista está vacía, el nuevo nodo pasa a ser el nodo del cursor.
+     */
+    void insertarDespuesDelCursor(const T& valor) {
+        insertarDespuesDeNodo(cabeza ? siguienteDe(previoCursor) : nullptr, valor);
+    }
+
+    /**
+     * @brief Elimina el nodo que sigue al del cursor, en O(1).
+     * Si el cursor está en el único nodo, la lista queda vacía.
+     */
+    void eliminarDespuesDelCursor() {
+        if (!cabeza) return;
+        eliminarSiguienteDe(siguienteDe(previoCursor));
+    }
+
+    /**
+     * @brief Elimina el nodo del cursor, en O(1); el cursor pasa al nodo siguiente.
+     */
+    void eliminarEnCursor() {
+        if (!cabeza) return;
+        // Se elimina el siguiente del anterior al cursor; previoCursor no cambia y ahora precede al nodo que seguía
+        eliminarSiguienteDe(previoCursor);
+    }
+
+    /**
+     * @brief Devuelve el número de nodos de la lista.
+     */
+    int obtenerTamano() const {
+        return tamano;
+    }
+
+    /**
+     * @brief Verifica si la lista está vacía.
+     */
+    bool estaVacia() const {
+        return !cabeza;
+    }
+
+    /**
+     * @brief Elimina todos los nodos, uno por uno desde la cabeza para no encadenar destructores.
+     */
+    void limpiar() {
+        while (cabeza) {
+            cabeza = std::move(cabeza->siguiente);
+        }
+        ultimo = nullptr;
+        previoCursor = nullptr;
+        tamano = 0;
+    }
 
 };
 
+/// Lista circular cuyos nodos se piden a un `std::pmr::memory_resource`, por ejemplo RecursoMonotono o RecursoPoolNodos.
+template <typename T>
+using ListaCircularPmr = ListaCircular<T, std::pmr::polymorphic_allocator<T>>;
+
 #endif
@@ -0,0 +1,27 @@
+/**
+ * @file NodoCircular.hpp
+ * @brief Definición de la estructura NodoCircular para una lista enlazada circular.
+ * @tparam T Tipo de dato almacenado en el nodo.
+ * @tparam Asignador Asignador con el que la lista crea sus nodos; el enlace lo usa para liberar el siguiente nodo.
+ * @details Esta estructura define un nodo que contiene un dato de tipo T y un puntero único al siguiente nodo.
+ * El nodo es utilizado en la implementación de una lista enlazada circular; el último nodo deja vacío su siguiente,
+ * porque el enlace de vuelta a la cabeza no es dueño y lo resuelve ListaCircular.
+ */
+
+#ifndef NODOCIRCULAR_HPP
+#define NODOCIRCULAR_HPP
+
+#include "../Memoria/GestorNodos.hpp"
+#include <memory>
+
+template <typename T, typename Asignador = std::allocator<T>>
+struct NodoCircular {
+    T dato; // Dato almacenado en el nodo
+    // Puntero único al siguiente nodo, permite la gestión automática de memoria
+    PunteroNodo<NodoCircular<T, Asignador>, Asignador> siguiente;
+
+    // Constructor para inicializar el nodo con un valor
+    NodoCircular(const T& valor) : dato(valor), siguiente(nullptr) {}
+};
+
+#endif
@@ -4,9 +4,14 @@
  * @details Este programa crea una lista circular, inserta nodos, muestra la lista,
  * elimina nodos y busca posiciones de valores en la lista.
  * Utiliza la clase ListaCircular definida en ListaCircular.hpp.
+ * Usa el cursor de la lista como despachador round-robin.
+ * El Despachador reparte pedidos entre trabajadores con pesos distintos.
+ * También muestra BufferCircular como ventana deslizante de capacidad fija.
  */
 
 #include "ListaCircular.hpp"
+#include "BufferCircular.hpp"
+#include "Despachador.hpp"
 #include <string>
 
 int main() {
@@ -30,5 +35,47 @@ int main() {
         std::cout << "El valor 'C' no se encuentra en la lista.\n";
     }
 
+    // Round-robin: el cursor gira sobre los trabajadores y cada paso cuesta O(1)
+    ListaCircular<std::string> turnos;
+    turnos.insertar("T1");
+    turnos.insertar("T2");
+    turnos.insertar("T3");
+    for (int i = 0; i < 4; ++i) {
+        std::cout << "Atiende: " << turnos.actual() << "\n";
+        turnos.avanzar();
+    }
+    turnos.insertarDespuesDelCursor("T4"); // Se une justo después del trabajador en turno
+    turnos.eliminarDespuesDelCursor();     // Y se retira otra vez sin recorrer el anillo
+    turnos.eliminarEnCursor();             // Sale el trabajador en turno; el cursor pasa al siguiente
+    std::cout << "En turno: " << turnos.actual() << "\n";
+    turnos.mostrar();
+
+    // Round-robin ponderado: por cada vuelta, "rapido" atiende 3 pedidos y "lento" 1
+    Despachador<std::string> despachador;
+    despachador.agregar("rapido", 3);
+    despachador.agregar("lento", 1);
+    for (int i = 0; i < 8; ++i) {
+        std::cout << despachador.siguiente() << " ";
+    }
+    std::cout << "\n";
+    despachador.retirar("lento");
+    despachador.agregar("nuevo", 2);
+    for (int i = 0; i < 5; ++i) {
+        std::cout << despachador.siguiente() << " ";
+    }
+    std::cout << "\n";
+    std::cout << "Pedidos de 'rapido': " << despachador.estadisticas("rapido")->despachados
+              << " de " << despachador.despachados() << "\n";
+
+    // Ventana deslizante: con capacidad 8, las inserciones 9 y 10 sobrescriben a las más antiguas
+    BufferCircular<int, 8> ventana;
+    for (int i = 1; i <= 10; ++i) {
+        ventana.insertar(i * 10);
+    }
+    ventana.mostrar();
+    std::cout << "Suma de los últimos 3: " << ventana.suma(3) << "\n";
+    std::cout << "Mínimo y máximo de los últimos 5: " << ventana.minimo(5) << " y " << ventana.maximo(5) << "\n";
+    std::cout << "Promedio de toda la ventana: " << ventana.promedio(ventana.tamano()) << "\n";
+
     return 0;
 }
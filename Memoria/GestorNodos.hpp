@@ -0,0 +1,111 @@
+/**
+ * @file GestorNodos.hpp
+ * @brief Creación y liberación de nodos a través de un asignador.
+ * Los contenedores enlazados reciben un asignador como parámetro de plantilla (compatible con `std::allocator`
+ * o un `std::pmr::polymorphic_allocator`) y crean sus nodos con GestorNodos en lugar de `std::make_unique`.
+ * Los enlaces siguen siendo `std::unique_ptr`, pero con GestorNodos como borrador: cada enlace sabe devolver
+ * su nodo al asignador que lo creó.
+ */
+#ifndef GESTORNODOS_HPP
+#define GESTORNODOS_HPP
+
+#include <memory>
+#include <memory_resource>
+#include <utility>
+
+/**
+ * @class AlmacenAsignador
+ * @brief Guarda una copia de un asignador sin ocupar espacio si el asignador no tiene estado.
+ * Hereda del asignador para que, con `std::allocator`, un enlace siga midiendo lo mismo que un puntero.
+ * @tparam Asignador Asignador ya adaptado al tipo de nodo.
+ */
+template <typename Asignador>
+class AlmacenAsignador : private Asignador {
+    public:
+        AlmacenAsignador() = default;
+        explicit AlmacenAsignador(const Asignador& asignador) : Asignador(asignador) {}
+
+        Asignador obtener() const { return *this; }
+};
+
+/**
+ * @brief Especialización para `std::pmr::polymorphic_allocator`, que no se puede asignar por copia:
+ * se guarda sólo el recurso y el asignador se reconstruye al usarlo.
+ */
+template <typename U>
+class AlmacenAsignador<std::pmr::polymorphic_allocator<U>> {
+    private:
+        std::pmr::memory_resource* recurso = std::pmr::get_default_resource();
+
+    public:
+        AlmacenAsignador() = default;
+        explicit AlmacenAsignador(const std::pmr::polymorphic_allocator<U>& asignador) : recurso(asignador.resource()) {}
+
+        std::pmr::polymorphic_allocator<U> obtener() const { return recurso; }
+};
+
+/**
+ * @class GestorNodos
+ * @brief Crea nodos con un asignador y sirve de borrador de los `std::unique_ptr` que los enlazan.
+ * El contenedor guarda un GestorNodos para crear nodos; cada enlace guarda otro, copiado del anterior,
+ * para liberar el nodo al que apunta. Así un nodo siempre vuelve al asignador del que salió, aunque pase
+ * de un contenedor a otro al mover o empalmar.
+ * @tparam Nodo Tipo de nodo; puede estar incompleto al declarar los enlaces.
+ * @tparam Asignador Asignador del tipo de dato del contenedor; se adapta al nodo con `rebind_alloc`.
+ */
+template <typename Nodo, typename Asignador>
+class GestorNodos
+    : private AlmacenAsignador<typename std::allocator_traits<Asignador>::template rebind_alloc<Nodo>> {
+    private:
+        using AsignadorNodo = typename std::allocator_traits<Asignador>::template rebind_alloc<Nodo>;
+        using Rasgos = std::allocator_traits<AsignadorNodo>;
+        using Almacen = AlmacenAsignador<AsignadorNodo>;
+
+    public:
+        using Puntero = std::unique_ptr<Nodo, GestorNodos>;
+
+        GestorNodos() = default;
+        explicit GestorNodos(const Asignador& asignador) : Almacen(AsignadorNodo(asignador)) {}
+
+        /**
+         * @brief Reserva y construye un nodo con el asignador.
+         * @param argumentos Argumentos del constructor del nodo.
+         * @return Enlace dueño del nodo, que lo devolverá a este mismo asignador.
+         */
+        template <typename... Argumentos>
+        Puntero crear(Argumentos&&... argumentos) const {
+            AsignadorNodo asignador = Almacen::obtener();
+            Nodo* nodo = Rasgos::allocate(asignador, 1);
+            try {
+                Rasgos::construct(asignador, nodo, std::forward<Argumentos>(argumentos)...);
+            } catch (...) {
+                Rasgos::deallocate(asignador, nodo, 1);
+                throw;
+            }
+            return Puntero(nodo, *this);
+        }
+
+        /**
+         * @brief Destruye un nodo y devuelve su memoria al asignador; es lo que llama `std::unique_ptr`.
+         */
+        void operator()(Nodo* nodo) const {
+            AsignadorNodo asignador = Almacen::obtener();
+            Rasgos::destroy(asignador, nodo);
+            Rasgos::deallocate(asignador, nodo, 1);
+        }
+
+        /**
+         * @brief Devuelve una copia del asignador, adaptada al tipo de dato del contenedor.
+         */
+        Asignador obtenerAsignador() const {
+            return Asignador(Almacen::obtener());
+        }
+};
+
+/**
+ * @brief Enlace dueño de un nodo creado con GestorNodos.
+ */
+template <typename Nodo, typename Asignador>
+using PunteroNodo = std::unique_ptr<Nodo, GestorNodos<Nodo, Asignador>>;
+
+#endif
@@ -0,0 +1,299 @@
+/**
+ * @file Recursos.hpp
+ * @brief Recursos de memoria (`std::pmr::memory_resource`) pensados para los nodos de los contenedores enlazados.
+ * RecursoMonotono reparte memoria de bloques grandes sin liberar nada hasta el final: sirve como arena por petición,
+ * que se descarta entera de una vez. RecursoPoolNodos guarda listas de bloques libres por tamaño, de modo que los
+ * nodos que se liberan se reutilizan sin volver a pedir memoria al sistema.
+ * Ninguno de los dos está sincronizado: cada uno debe usarse desde un solo hilo a la vez.
+ */
+#ifndef RECURSOS_HPP
+#define RECURSOS_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+
+/**
+ * @class RecursoMonotono
+ * @brief Arena que reparte memoria avanzando un puntero y sólo la libera toda junta.
+ *
+ * Reservar cuesta un redondeo y una comparación; liberar un nodo no hace nada. Cuando el bloque actual se agota se
+ * pide otro al recurso superior, del doble de tamaño que el anterior (hasta TAMANO_BLOQUE_MAXIMO).
+ * liberar() devuelve todos los bloques; reiniciar() conserva el más grande para que la siguiente petición
+ * no tenga que volver a pedir memoria.
+ * Los contenedores que usan la arena deben destruirse antes que ella o vaciarse antes de liberar() / reiniciar().
+ */
+class RecursoMonotono : public std::pmr::memory_resource {
+    public:
+        static constexpr std::size_t TAMANO_BLOQUE_INICIAL = std::size_t(64) << 10;
+        static constexpr std::size_t TAMANO_BLOQUE_MAXIMO = std::size_t(64) << 20;
+
+    private:
+        /// Cabecera al inicio de cada bloque pedido al recurso superior; los bloques forman una pila.
+        struct Bloque {
+            Bloque* anterior;
+            std::size_t tamano;
+        };
+
+        std::pmr::memory_resource* superior;
+        Bloque* bloques = nullptr;         ///< Último bloque pedido.
+        char* libre = nullptr;             ///< Siguiente byte disponible del bloque actual.
+        char* fin = nullptr;               ///< Fin del bloque actual.
+        std::size_t siguienteTamano;       ///< Tamaño del próximo bloque.
+        std::size_t reservados = 0;        ///< Bytes pedidos al recurso superior.
+
+        /**
+         * @brief Pide un bloque nuevo con espacio para al menos `bytes` con la alineación indicada.
+         */
+        void crecer(std::size_t bytes, std::size_t alineacion) {
+            std::size_t necesario = sizeof(Bloque) + bytes + alineacion;
+            std::size_t tamano = std::max(siguienteTamano, necesario);
+            auto* bloque = static_cast<Bloque*>(superior->allocate(tamano, alignof(std::max_align_t)));
+            bloque->anterior = bloques;
+            bloque->tamano = tamano;
+            bloques = bloque;
+            reservados += tamano;
+            libre = reinterpret_cast<char*>(bloque) + sizeof(Bloque);
+            fin = reinterpret_cast<char*>(bloque) + tamano;
+            siguienteTamano = std::min(siguienteTamano * 2, TAMANO_BLOQUE_MAXIMO);
+        }
+
+    protected:
+        void* do_allocate(std::size_t bytes, std::size_t alineacion) override {
+            auto direccion = reinterpret_cast<std::uintptr_t>(libre);
+            auto alineada = (direccion + alineacion - 1) & ~(static_cast<std::uintptr_t>(alineacion) - 1);
+            if (libre == nullptr || alineada + bytes > reinterpret_cast<std::uintptr_t>(fin)) {
+                crecer(bytes, alineacion);
+                direccion = reinterpret_cast<std::uintptr_t>(libre);
+                alineada = (direccion + alineacion - 1) & ~(static_cast<std::uintptr_t>(alineacion) - 1);
+            }
+            libre = reinterpret_cast<char*>(alineada + bytes);
+            return reinterpret_cast<void*>(alineada);
+        }
+
+        void do_deallocate(void*, std::size_t, std::size_t) override {
+            // La memoria se recupera toda junta en liberar() o reiniciar()
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& otro) const noexcept override {
+            return this == &otro;
+        }
+
+    public:
+        /**
+         * @brief Crea una arena vacía; el primer bloque se pide con la primera reserva.
+         * @param tamanoInicial Tamaño del primer bloque.
+         * @param superior Recurso del que se piden los bloques.
+         */
+        explicit RecursoMonotono(std::size_t tamanoInicial = TAMANO_BLOQUE_INICIAL,
+                                 std::pmr::memory_resource* superior = std::pmr::new_delete_resource())
+            : superior(superior), siguienteTamano(std::max(tamanoInicial, sizeof(Bloque) + 64)) {}
+
+        ~RecursoMonotono() override {
+            liberar();
+        }
+
+        RecursoMonotono(const RecursoMonotono&) = delete;
+        RecursoMonotono& operator=(const RecursoMonotono&) = delete;
+
+        /**
+         * @brief Devuelve todos los bloques al recurso superior.
+         */
+        void liberar() {
+            while (bloques) {
+                Bloque* anterior = bloques->anterior;
+                superior->deallocate(bloques, bloques->tamano, alignof(std::max_align_t));
+                bloques = anterior;
+            }
+            libre = nullptr;
+            fin = nullptr;
+            reservados = 0;
+        }
+
+        /**
+         * @brief Olvida todo lo repartido, pero conserva el bloque más grande para reutilizarlo.
+         * Pensado para arenas por petición: tras la primera petición ya no se pide memoria al sistema.
+         * Normalmente es el más reciente, pero tras una reserva enorme puede haber bloques más nuevos y más chicos.
+         */
+        void reiniciar() {
+            if (!bloques) {
+                return;
+            }
+            // Se busca el bloque más grande y se desengancha de la lista; los demás se devuelven
+            Bloque** enlaceMayor = &bloques;
+            for (Bloque** enlace = &bloques; *enlace; enlace = &(*enlace)->anterior) {
+                if ((*enlace)->tamano > (*enlaceMayor)->tamano) {
+                    enlaceMayor = enlace;
+                }
+            }
+            Bloque* conservado = *enlaceMayor;
+            *enlaceMayor = conservado->anterior;
+            liberar();
+            conservado->anterior = nullptr;
+            bloques = conservado;
+            reservados = conservado->tamano;
+            libre = reinterpret_cast<char*>(conservado) + sizeof(Bloque);
+            fin = reinterpret_cast<char*>(conservado) + conservado->tamano;
+        }
+
+        /**
+         * @brief Bytes pedidos al recurso superior y aún no devueltos.
+         */
+        std::size_t bytesReservados() const {
+            return reservados;
+        }
+};
+
+/**
+ * @class RecursoPoolNodos
+ * @brief Recurso con una lista de bloques libres por cada tamaño de nodo, de 8 en 8 bytes hasta TAMANO_MAXIMO.
+ *
+ * Un nodo de lista o de árbol mide unas pocas decenas de bytes y todos los de un contenedor miden lo mismo, así que
+ * cada clase de tamaño reparte bloques de páginas contiguas (losas) y recibe de vuelta los que se liberan.
+ * Reservar y liberar cuestan O(1) y no tocan el recurso superior salvo al crear una losa.
+ * Los bloques más grandes que TAMANO_MAXIMO, o con alineación mayor que la de `std::max_align_t`,
+ * se piden directamente al recurso superior.
+ */
+class RecursoPoolNodos : public std::pmr::memory_resource {
+    public:
+        static constexpr std::size_t GRANULARIDAD = 8;
+        static constexpr std::size_t TAMANO_MAXIMO = 256;
+        static constexpr std::size_t TAMANO_LOSA_INICIAL = std::size_t(4) << 10;
+        static constexpr std::size_t TAMANO_LOSA_MAXIMO = std::size_t(256) << 10;
+
+    private:
+        static constexpr std::size_t CLASES = TAMANO_MAXIMO / GRANULARIDAD;
+
+        struct Libre {
+            Libre* siguiente;
+        };
+
+        /// Cabecera de cada losa pedida al recurso superior; las losas de todas las clases forman una pila.
+        struct Losa {
+            Losa* anterior;
+            std::size_t tamano;
+        };
+
+        /// Estado de una clase de tamaño: bloques devueltos y resto sin repartir de la última losa.
+        struct Clase {
+            Libre* libres = nullptr;
+            char* siguiente = nullptr;
+            char* fin = nullptr;
+            std::size_t tamanoLosa = TAMANO_LOSA_INICIAL;
+        };
+
+        std::pmr::memory_resource* superior;
+        Clase clases[CLASES];
+        Losa* losas = nullptr;
+        std::size_t reservados = 0;
+
+        /**
+         * @brief Índice de la clase de tamaño de un bloque, o CLASES si se pide al recurso superior.
+         * El tamaño se redondea a un múltiplo de la alineación: como las losas están alineadas a `max_align_t`,
+         * todos los bloques de la clase quedan alineados.
+         */
+        static std::size_t claseDe(std::size_t bytes, std::size_t alineacion) {
+            if (alineacion > alignof(std::max_align_t)) {
+                return CLASES;
+            }
+            std::size_t paso = std::max(alineacion, GRANULARIDAD);
+            std::size_t redondeado = (std::max<std::size_t>(bytes, 1) + paso - 1) / paso * paso;
+            return redondeado <= TAMANO_MAXIMO ? redondeado / GRANULARIDAD - 1 : CLASES;
+        }
+
+        /**
+         * @brief Pide una losa nueva para una clase; cada losa es el doble de la anterior hasta TAMANO_LOSA_MAXIMO.
+         */
+        void nuevaLosa(Clase& clase, std::size_t tamanoBloque) {
+            std::size_t tamano = std::max(clase.tamanoLosa, sizeof(Losa) + alignof(std::max_align_t) + tamanoBloque);
+            auto* losa = static_cast<Losa*>(superior->allocate(tamano, alignof(std::max_align_t)));
+            losa->anterior = losas;
+            losa->tamano = tamano;
+            losas = losa;
+            reservados += tamano;
+            // El primer bloque empieza tras la cabecera, alineado a max_align_t
+            std::size_t cabecera = (sizeof(Losa) + alignof(std::max_align_t) - 1) / alignof(std::max_align_t)
+                                   * alignof(std::max_align_t);
+            clase.siguiente = reinterpret_cast<char*>(losa) + cabecera;
+            clase.fin = reinterpret_cast<char*>(losa) + tamano;
+            clase.tamanoLosa = std::min(clase.tamanoLosa * 2, TAMANO_LOSA_MAXIMO);
+        }
+
+    protected:
+        void* do_allocate(std::size_t bytes, std::size_t alineacion) override {
+            std::size_t indice = claseDe(bytes, alineacion);
+            if (indice == CLASES) {
+                return superior->allocate(bytes, alineacion);
+            }
+            Clase& clase = clases[indice];
+            if (clase.libres) {
+                Libre* bloque = clase.libres;
+                clase.libres = bloque->siguiente;
+                return bloque;
+            }
+            std::size_t tamanoBloque = (indice + 1) * GRANULARIDAD;
+            if (clase.siguiente == nullptr || clase.siguiente + tamanoBloque > clase.fin) {
+                nuevaLosa(clase, tamanoBloque);
+            }
+            void* bloque = clase.siguiente;
+            clase.siguiente += tamanoBloque;
+            return bloque;
+        }
+
+        void do_deallocate(void* memoria, std::size_t bytes, std::size_t alineacion) override {
+            std::size_t indice = claseDe(bytes, alineacion);
+            if (indice == CLASES) {
+                superior->deallocate(memoria, bytes, alineacion);
+                return;
+            }
+            Libre* bloque = static_cast<Libre*>(memoria);
+            bloque->siguiente = clases[indice].libres;
+            clases[indice].libres = bloque;
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& otro) const noexcept override {
+            return this == &otro;
+        }
+
+    public:
+        /**
+         * @param superior Recurso del que se piden las losas y los bloques grandes;
+         * puede ser un RecursoMonotono para tener una arena que además reutiliza los nodos liberados.
+         */
+        explicit RecursoPoolNodos(std::pmr::memory_resource* superior = std::pmr::new_delete_resource())
+            : superior(superior) {}
+
+        ~RecursoPoolNodos() override {
+            liberar();
+        }
+
+        RecursoPoolNodos(const RecursoPoolNodos&) = delete;
+        RecursoPoolNodos& operator=(const RecursoPoolNodos&) = delete;
+
+        /**
+         * @brief Devuelve todas las losas al recurso superior y vacía las listas de bloques libres.
+         * Los bloques grandes, pedidos directamente al recurso superior, los libera quien los reservó.
+         */
+        void liberar() {
+            while (losas) {
+                Losa* anterior = losas->anterior;
+                superior->deallocate(losas, losas->tamano, alignof(std::max_align_t));
+                losas = anterior;
+            }
+            for (Clase& clase : clases) {
+                clase = Clase();
+            }
+            reservados = 0;
+        }
+
+        /**
+         * @brief Bytes de losas pedidos al recurso superior y aún no devueltos.
+         */
+        std::size_t bytesReservados() const {
+            return reservados;
+        }
+};
+
+#endif
@@ -0,0 +1,137 @@
+/**
+ * @file main.cpp
+ * @brief Programa de ejemplo de los asignadores de nodos.
+ * Usa un asignador propio compatible con std::allocator, una arena por petición (RecursoMonotono)
+ * y un pool de nodos (RecursoPoolNodos) con los contenedores enlazados, y compara tiempos contra std::allocator.
+ */
+#include "GestorNodos.hpp"
+#include "Recursos.hpp"
+#include "../ArbolBinario/Arbol.hpp"
+#include "../Cola/Cola.hpp"
+#include "../ListaDoblementeEnlazada/listaDoble.hpp"
+#include "../ListaEnlazada/Lista.hpp"
+#include "../ListaSimplementeEnlazadaCircular/ListaCircular.hpp"
+#include "../Pila/Pila.hpp"
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+
+namespace {
+
+double milisegundosDesde(std::chrono::steady_clock::time_point inicio) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - inicio).count();
+}
+
+/// Cuenta las reservas vivas de todos los AsignadorContador.
+long long reservasVivas = 0;
+
+/**
+ * @brief Asignador mínimo compatible con std::allocator que cuenta cuántos bloques siguen reservados.
+ */
+template <typename T>
+struct AsignadorContador {
+    using value_type = T;
+
+    AsignadorContador() = default;
+    template <typename U>
+    AsignadorContador(const AsignadorContador<U>&) {}
+
+    T* allocate(std::size_t n) {
+        reservasVivas++;
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* memoria, std::size_t n) {
+        reservasVivas--;
+        std::allocator<T>().deallocate(memoria, n);
+    }
+
+    template <typename U>
+    bool operator==(const AsignadorContador<U>&) const { return true; }
+    template <typename U>
+    bool operator!=(const AsignadorContador<U>&) const { return false; }
+};
+
+/// Simula una petición que arma una lista y un árbol temporales y devuelve un resultado que no depende de ellos.
+template <typename ListaT, typename ArbolT, typename... Recurso>
+long long atenderPeticion(int semilla, int elementos, Recurso... recurso) {
+    ListaT lista(recurso...);
+    ArbolT arbol(recurso...);
+    unsigned valor = static_cast<unsigned>(semilla);
+    for (int i = 0; i < elementos; ++i) {
+        valor = valor * 1664525u + 1013904223u;
+        lista.insertarAlFinal(static_cast<int>(valor % 1000));
+        arbol.insertar(static_cast<int>(valor % 100000));
+    }
+    return lista.obtenerTamano() + arbol.altura();
+}
+
+} // namespace
+
+int main() {
+    // Un asignador propio: todas las reservas de nodos pasan por él
+    {
+        Lista<int, SinInstrumentacion, AsignadorContador<int>> lista;
+        ListaDoble<int, SinInstrumentacion, AsignadorContador<int>> doble;
+        for (int i = 0; i < 5; ++i) {
+            lista.insertarAlFinal(i);
+            doble.insertarAlInicio(i);
+        }
+        std::cout << "Reservas vivas con AsignadorContador: " << reservasVivas << "\n";
+    }
+    std::cout << "Reservas vivas tras destruir los contenedores: " << reservasVivas << "\n";
+
+    // Un pool de nodos: la pila y la cola reutilizan los nodos que liberan
+    RecursoPoolNodos pool;
+    {
+        PilaPmr<int> pila(&pool);
+        ColaPmr<int> cola(&pool);
+        ListaCircularPmr<int> anillo(&pool);
+        for (int ronda = 0; ronda < 1000; ++ronda) {
+            for (int i = 0; i < 100; ++i) {
+                pila.push(i);
+                cola.encolar(i);
+            }
+            while (!pila.isEmpty()) pila.pop();
+            while (!cola.estaVacia()) cola.desencolar();
+        }
+        for (int i = 1; i <= 3; ++i) anillo.insertar(i);
+        std::cout << "Anillo en el pool, actual: " << anillo.actual() << "\n";
+    }
+    std::cout << "Pool tras 200000 nodos creados y liberados: " << pool.bytesReservados() << " bytes pedidos al sistema\n";
+
+    // Arena por petición: la memoria de cada petición se descarta entera con reiniciar()
+    const int PETICIONES = 2000;
+    const int ELEMENTOS = 500;
+    long long control = 0;
+
+    auto inicio = std::chrono::steady_clock::now();
+    for (int p = 0; p < PETICIONES; ++p) {
+        control += atenderPeticion<Lista<int>, Arbol<int>>(p, ELEMENTOS);
+    }
+    double conEstandar = milisegundosDesde(inicio);
+
+    RecursoMonotono arena;
+    inicio = std::chrono::steady_clock::now();
+    for (int p = 0; p < PETICIONES; ++p) {
+        control -= atenderPeticion<ListaPmr<int>, ArbolPmr<int>>(p, ELEMENTOS, &arena);
+        arena.reiniciar();
+    }
+    double conArena = milisegundosDesde(inicio);
+
+    RecursoPoolNodos poolPeticiones;
+    inicio = std::chrono::steady_clock::now();
+    for (int p = 0; p < PETICIONES; ++p) {
+        control += atenderPeticion<ListaPmr<int>, ArbolPmr<int>>(p, ELEMENTOS, &poolPeticiones);
+    }
+    double conPool = milisegundosDesde(inicio);
+
+    std::cout << PETICIONES << " peticiones de " << ELEMENTOS << " elementos:\n"
+              << "  std::allocator:   " << conEstandar << " ms\n"
+              << "  RecursoMonotono:  " << conArena << " ms (" << arena.bytesReservados() << " bytes retenidos)\n"
+              << "  RecursoPoolNodos: " << conPool << " ms (" << poolPeticiones.bytesReservados() << " bytes retenidos)\n"
+              << "  (control: " << control << ")\n";
+
+    return 0;
+}
@@ -1,27 +1,29 @@
 /**
- * @file nodo.hpp
- * @brief Definición de la clase Nodo para una pila.
+ * @file NodoPila.hpp
+ * @brief Definición de la clase NodoPila para una pila.
  * Esta clase es parte de una implementación de pila.
  * Utiliza punteros inteligentes para manejar la memoria de manera segura.
  */
-#ifndef NODO_HPP
-#define NODO_HPP
+#ifndef NODOPILA_HPP
+#define NODOPILA_HPP
 
+#include "../Memoria/GestorNodos.hpp"
 #include <memory>
 
-template <typename T>
+template <typename T, typename Asignador = std::allocator<T>>
 
 /**
- * @class Nodo
+ * @class NodoPila
  * @brief Clase que representa un nodo en una pila.
  * Cada nodo contiene un valor de tipo T y un puntero al siguiente nodo.
  * Utiliza `std::unique_ptr` para gestionar la memoria del siguiente nodo, lo que evita fugas de memoria y facilita la gestión de la lista enlazada.
  * @tparam T Tipo de dato almacenado en el nodo.
+ * @tparam Asignador Asignador con el que la pila crea sus nodos; el enlace lo usa para liberar el siguiente nodo.
  */
-class Nodo {
+class NodoPila {
     public:
         T dato;
-        std::unique_ptr<Nodo<T>> siguiente;
-        Nodo(const T& valor) : dato(valor), siguiente(nullptr) {}
+        PunteroNodo<NodoPila<T, Asignador>, Asignador> siguiente;
+        NodoPila(const T& valor) : dato(valor), siguiente(nullptr) {}
 };
 #endif
\ No newline at end of file
@@ -3,12 +3,15 @@
  * @brief Definición de la clase Pila.
  * Esta clase implementa una pila.
  * Utiliza punteros inteligentes para manejar la memoria de manera segura. 
+ * Los nodos se crean con un asignador configurable, de modo que la pila puede vivir en una arena o en un pool.
  */
 
 #ifndef PILA_HPP
 #define PILA_HPP
-#include "Nodo.hpp"
+#include "NodoPila.hpp"
+#include "../Instrumentacion/Instrumentacion.hpp"
 #include <memory>
+#include <memory_resource>
 #include <iostream>
 
 /**
@@ -17,23 +20,67 @@
  * Implementa las operaciones básicas de una pila: push, pop, top, isEmpty, size, clear y mostrar.
  * Utiliza `std::unique_ptr` para gestionar la memoria de los nodos de manera segura.
  * @tparam T Tipo de dato almacenado en la pila.
+ * @tparam Instrumentacion Política de instrumentación; por defecto no mide nada.
+ * @tparam Asignador Asignador de los nodos: `std::allocator` o compatible, o `std::pmr::polymorphic_allocator`.
  */
-template <typename T>
+template <typename T, typename Instrumentacion = SinInstrumentacion, typename Asignador = std::allocator<T>>
 class Pila {
     private:
-        std::unique_ptr<Nodo<T>> cima; ///< Puntero al nodo superior de la pila.
+        GestorNodos<NodoPila<T, Asignador>, Asignador> gestor; ///< Crea los nodos con el asignador.
+        PunteroNodo<NodoPila<T, Asignador>, Asignador> cima; ///< Puntero al nodo superior de la pila.
         size_t tamano; ///< Tamaño actual de la pila.
 
     public:
-        Pila() : cima(nullptr), tamano(0) {} ///Constructor por defecto que inicializa la pila vacía.
+        /// Constructor que inicializa la pila vacía; los nodos se pedirán al asignador indicado.
+        explicit Pila(const Asignador& asignador = Asignador()) : gestor(asignador), cima(nullptr), tamano(0) {}
+
+        /**
+         * @brief Destructor de la pila; libera los nodos de forma iterativa con clear().
+         */
+        ~Pila() {
+            clear();
+        }
+
+        Pila(const Pila&) = delete;
+        Pila& operator=(const Pila&) = delete;
+
+        /**
+         * @brief Constructor de movimiento: toma los nodos y el asignador de otra pila, que queda vacía.
+         */
+        Pila(Pila&& otra) noexcept : gestor(otra.gestor), cima(std::move(otra.cima)), tamano(otra.tamano) {
+            otra.tamano = 0;
+        }
+
+        /**
+         * @brief Asignación por movimiento: libera los nodos propios y toma los de otra pila.
+         * Los nodos tomados vuelven al asignador de la otra pila cuando se liberan.
+         */
+        Pila& operator=(Pila&& otra) noexcept {
+            if (this != &otra) {
+                clear();
+                cima = std::move(otra.cima);
+                tamano = otra.tamano;
+                otra.tamano = 0;
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Devuelve una copia del asignador con el que se crean los nodos.
+         */
+        Asignador obtenerAsignador() const {
+            return gestor.obtenerAsignador();
+        }
 
         /**
          * @brief Inserta un elemento en la parte superior de la pila.
          * @param valor Valor a insertar en la pila.
          */
         void push(const T& valor) {
+            typename Instrumentacion::Temporizador medir("pila_push");
             // Ej: [cima] -> [30] -> [20] -> [10] -> nullptr
-            auto nuevoNodo = std::make_unique<Nodo<T>>(valor);
+            Instrumentacion::asignacion();
+            auto nuevoNodo = gestor.crear(valor);
             //El nuevo nodo apunta a donde antes apuntaba la cima
             nuevoNodo->siguiente = std::move(cima);
             cima = std::move(nuevoNodo);
@@ -45,6 +92,7 @@ class Pila {
          * @throws std::runtime_error Si la pila está vacía.
          */
         void pop() {
+            typename Instrumentacion::Temporizador medir("pila_pop");
             if (!cima) {
                 std::cout << "La pila está vacía. No se puede eliminar el elemento superior." << std::endl;
                 return;
@@ -84,11 +132,18 @@ class Pila {
 
         /**
          * @brief Limpia la pila, eliminando todos los elementos.
+         * Los nodos se liberan uno por uno desde la cima para no encadenar destructores.
          */
         void clear() {
-            cima == nullptr;
+            while (cima) {
+                cima = std::move(cima->siguiente);
+            }
             tamano = 0;
         }
 };
 
+/// Pila cuyos nodos se piden a un `std::pmr::memory_resource`, por ejemplo RecursoMonotono o RecursoPoolNodos.
+template <typename T, typename Instrumentacion = SinInstrumentacion>
+using PilaPmr = Pila<T, Instrumentacion, std::pmr::polymorphic_allocator<T>>;
+
 #endif
\ No newline at end of file
@@ -0,0 +1,402 @@
+/**
+ * @file Reduccion.hpp
+ * @brief Reducciones sobre arreglos contiguos: suma, mínimo, máximo, promedio y suma prefija.
+ * Todas son iterativas, así que no dependen del tamaño de la pila como la suma recursiva original.
+ * Para arreglos de int se elige en tiempo de ejecución, según el procesador, un núcleo AVX2, uno SSE4.1
+ * o uno escalar. Cada versión tiene además una variante paralela que reparte el arreglo en tramos entre hilos.
+ * Las sumas se acumulan en 64 bits (long long, o double para flotantes) para no desbordar el tipo del arreglo:
+ * con int, el acumulador no se desborda mientras el arreglo tenga menos de 2^32 elementos.
+ */
+#ifndef REDUCCION_HPP
+#define REDUCCION_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define REDUCCION_X86 1
+#include <immintrin.h>
+#endif
+
+/**
+ * @brief Conjunto de instrucciones vectoriales que usan los núcleos para int.
+ */
+enum class NivelSimd {
+    Escalar,
+    SSE41,
+    AVX2
+};
+
+/**
+ * @brief Tipo en que se acumulan las sumas de un arreglo de T.
+ */
+template <typename T>
+using Acumulador = typename std::conditional<std::is_floating_point<T>::value, double,
+                   typename std::conditional<std::is_signed<T>::value, long long, unsigned long long>::type>::type;
+
+/**
+ * @brief Detecta una sola vez el mejor nivel que soporta el procesador.
+ */
+inline NivelSimd nivelSimdDetectado() {
+    static const NivelSimd nivel = [] {
+#ifdef REDUCCION_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            return NivelSimd::AVX2;
+        }
+        if (__builtin_cpu_supports("sse4.1")) {
+            return NivelSimd::SSE41;
+        }
+#endif
+        return NivelSimd::Escalar;
+    }();
+    return nivel;
+}
+
+inline const char* nombreNivelSimd(NivelSimd nivel) {
+    switch (nivel) {
+        case NivelSimd::AVX2: return "AVX2";
+        case NivelSimd::SSE41: return "SSE4.1";
+        default: return "escalar";
+    }
+}
+
+/**
+ * @brief Lanza una excepción si el arreglo está vacío; mínimo, máximo y promedio no tienen valor en ese caso.
+ */
+inline void validarNoVacio(std::size_t n) {
+    if (n == 0) {
+        throw std::runtime_error("El arreglo está vacío. No hay elementos que reducir.");
+    }
+}
+
+// Núcleos escalares, válidos para cualquier tipo numérico
+
+/**
+ * @brief Suma con cuatro acumuladores independientes, para que el procesador no espere a cada suma anterior.
+ */
+template <typename T>
+Acumulador<T> sumarEscalar(const T* datos, std::size_t n) {
+    Acumulador<T> a0 = 0, a1 = 0, a2 = 0, a3 = 0;
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        a0 += datos[i];
+        a1 += datos[i + 1];
+        a2 += datos[i + 2];
+        a3 += datos[i + 3];
+    }
+    for (; i < n; ++i) {
+        a0 += datos[i];
+    }
+    return (a0 + a1) + (a2 + a3);
+}
+
+template <typename T>
+T minimoEscalar(const T* datos, std::size_t n) {
+    return *std::min_element(datos, datos + n);
+}
+
+template <typename T>
+T maximoEscalar(const T* datos, std::size_t n) {
+    return *std::max_element(datos, datos + n);
+}
+
+// Núcleos vectoriales para int. Se compilan con el atributo target, así que el resto
+// del programa no necesita -mavx2 y el mismo binario funciona en procesadores sin AVX2.
+#ifdef REDUCCION_X86
+
+__attribute__((target("avx2"))) inline long long sumarAvx2(const int* datos, std::size_t n) {
+    // Cada 8 int se extienden a 64 bits en dos mitades de 4 y se acumulan por separado
+    __m256i a0 = _mm256_setzero_si256();
+    __m256i a1 = _mm256_setzero_si256();
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(datos + i));
+        a0 = _mm256_add_epi64(a0, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+        a1 = _mm256_add_epi64(a1, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+    }
+    alignas(32) long long partes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(partes), _mm256_add_epi64(a0, a1));
+    long long total = partes[0] + partes[1] + partes[2] + partes[3];
+    for (; i < n; ++i) {
+        total += datos[i];
+    }
+    return total;
+}
+
+__attribute__((target("sse4.1"))) inline long long sumarSse41(const int* datos, std::size_t n) {
+    __m128i a0 = _mm_setzero_si128();
+    __m128i a1 = _mm_setzero_si128();
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(datos + i));
+        a0 = _mm_add_epi64(a0, _mm_cvtepi32_epi64(v));
+        a1 = _mm_add_epi64(a1, _mm_cvtepi32_epi64(_mm_srli_si128(v, 8)));
+    }
+    alignas(16) long long partes[2];
+    _mm_store_si128(reinterpret_cast<__m128i*>(partes), _mm_add_epi64(a0, a1));
+    long long total = partes[0] + partes[1];
+    for (; i < n; ++i) {
+        total += datos[i];
+    }
+    return total;
+}
+
+/**
+ * @brief Mínimo (o máximo, si maximo es true) con AVX2; n debe ser al menos 1.
+ */
+__attribute__((target("avx2"))) inline int extremoAvx2(const int* datos, std::size_t n, bool maximo) {
+    if (n < 8) {
+        return maximo ? maximoEscalar(datos, n) : minimoEscalar(datos, n);
+    }
+    __m256i acumulado = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(datos));
+    std::size_t i = 8;
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(datos + i));
+        acumulado = maximo ? _mm256_max_epi32(acumulado, v) : _mm256_min_epi32(acumulado, v);
+    }
+    // La cola se cubre con los últimos 8 elementos, que se solapan con lo ya visto sin alterar el resultado
+    __m256i cola = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(datos + n - 8));
+    acumulado = maximo ? _mm256_max_epi32(acumulado, cola) : _mm256_min_epi32(acumulado, cola);
+    alignas(32) int partes[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(partes), acumulado);
+    return maximo ? maximoEscalar(partes, 8) : minimoEscalar(partes, 8);
+}
+
+__attribute__((target("sse4.1"))) inline int extremoSse41(const int* datos, std::size_t n, bool maximo) {
+    if (n < 4) {
+        return maximo ? maximoEscalar(datos, n) : minimoEscalar(datos, n);
+    }
+    __m128i acumulado = _mm_loadu_si128(reinterpret_cast<const __m128i*>(datos));
+    std::size_t i = 4;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(datos + i));
+        acumulado = maximo ? _mm_max_epi32(acumulado, v) : _mm_min_epi32(acumulado, v);
+    }
+    __m128i cola = _mm_loadu_si128(reinterpret_cast<const __m128i*>(datos + n - 4));
+    acumulado = maximo ? _mm_max_epi32(acumulado, cola) : _mm_min_epi32(acumulado, cola);
+    alignas(16) int partes[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(partes), acumulado);
+    return maximo ? maximoEscalar(partes, 4) : minimoEscalar(partes, 4);
+}
+
+#endif
+
+// Reducciones secuenciales
+
+/**
+ * @brief Suma de los n elementos del arreglo; 0 si está vacío.
+ */
+template <typename T>
+Acumulador<T> sumar(const T* datos, std::size_t n) {
+    return sumarEscalar(datos, n);
+}
+
+/**
+ * @brief Suma de un arreglo de int con el mejor núcleo disponible.
+ */
+inline long long sumar(const int* datos, std::size_t n) {
+#ifdef REDUCCION_X86
+    switch (nivelSimdDetectado()) {
+        case NivelSimd::AVX2: return sumarAvx2(datos, n);
+        case NivelSimd::SSE41: return sumarSse41(datos, n);
+        default: break;
+    }
+#endif
+    return sumarEscalar(datos, n);
+}
+
+/**
+ * @brief Menor elemento del arreglo.
+ * @throws std::runtime_error Si el arreglo está vacío.
+ */
+template <typename T>
+T minimo(const T* datos, std::size_t n) {
+    validarNoVacio(n);
+    return minimoEscalar(datos, n);
+}
+
+inline int minimo(const int* datos, std::size_t n) {
+    validarNoVacio(n);
+#ifdef REDUCCION_X86
+    switch (nivelSimdDetectado()) {
+        case NivelSimd::AVX2: return extremoAvx2(datos, n, false);
+        case NivelSimd::SSE41: return extremoSse41(datos, n, false);
+        default: break;
+    }
+#endif
+    return minimoEscalar(datos, n);
+}
+
+/**
+ * @brief Mayor elemento del arreglo.
+ * @throws std::runtime_error Si el arreglo está vacío.
+ */
+template <typename T>
+T maximo(const T* datos, std::size_t n) {
+    validarNoVacio(n);
+    return maximoEscalar(datos, n);
+}
+
+inline int maximo(const int* datos, std::size_t n) {
+    validarNoVacio(n);
+#ifdef REDUCCION_X86
+    switch (nivelSimdDetectado()) {
+        case NivelSimd::AVX2: return extremoAvx2(datos, n, true);
+        case NivelSimd::SSE41: return extremoSse41(datos, n, true);
+        default: break;
+    }
+#endif
+    return maximoEscalar(datos, n);
+}
+
+/**
+ * @brief Promedio de los elementos, calculado a partir de la suma en 64 bits.
+ * @throws std::runtime_error Si el arreglo está vacío.
+ */
+template <typename T>
+double promedio(const T* datos, std::size_t n) {
+    validarNoVacio(n);
+    return static_cast<double>(sumar(datos, n)) / static_cast<double>(n);
+}
+
+/**
+ * @brief Suma prefija inclusiva: salida[i] = datos[0] + ... + datos[i].
+ * @param salida Arreglo de n acumuladores; puede no ser el mismo que datos.
+ */
+template <typename T>
+void sumaPrefija(const T* datos, std::size_t n, Acumulador<T>* salida, Acumulador<T> inicial = 0) {
+    Acumulador<T> acumulado = inicial;
+    for (std::size_t i = 0; i < n; ++i) {
+        acumulado += datos[i];
+        salida[i] = acumulado;
+    }
+}
+
+// Reducciones paralelas: el arreglo se parte en un tramo contiguo por hilo
+
+/**
+ * @brief Número de hilos a usar: no más de los pedidos (0 = los del procesador)
+ * ni tantos que cada uno reciba menos de 64 Ki elementos, donde crear el hilo cuesta más que el trabajo.
+ */
+inline unsigned hilosParaReduccion(std::size_t n, unsigned hilos) {
+    const std::size_t minimoPorHilo = std::size_t(1) << 16;
+    if (hilos == 0) {
+        hilos = std::max(1u, std::thread::hardware_concurrency());
+    }
+    std::size_t utiles = std::max<std::size_t>(1, n / minimoPorHilo);
+    return static_cast<unsigned>(std::min<std::size_t>(hilos, utiles));
+}
+
+/**
+ * @brief Aplica funcion(tramo, inicio, fin) a cada tramo en su propio hilo y devuelve los resultados en orden.
+ * El hilo que llama se encarga del último tramo.
+ */
+template <typename R, typename Funcion>
+std::vector<R> porTramos(std::size_t n, unsigned hilos, Funcion funcion) {
+    std::vector<R> resultados(hilos);
+    std::vector<std::thread> trabajadores;
+    trabajadores.reserve(hilos - 1);
+    for (unsigned t = 0; t + 1 < hilos; ++t) {
+        trabajadores.emplace_back([&resultados, &funcion, t, n, hilos] {
+            resultados[t] = funcion(t, n * t / hilos, n * (t + 1) / hilos);
+        });
+    }
+    resultados[hilos - 1] = funcion(hilos - 1, n * (hilos - 1) / hilos, n);
+    for (std::thread& trabajador : trabajadores) {
+        trabajador.join();
+    }
+    return resultados;
+}
+
+/**
+ * @brief Suma repartida entre hilos.
+ * @param hilos Número máximo de hilos; 0 usa los del procesador.
+ */
+template <typename T>
+auto sumarParalelo(const T* datos, std::size_t n, unsigned hilos = 0) -> decltype(sumar(datos, n)) {
+    using R = decltype(sumar(datos, n));
+    hilos = hilosParaReduccion(n, hilos);
+    if (hilos == 1) {
+        return sumar(datos, n);
+    }
+    std::vector<R> parciales = porTramos<R>(n, hilos, [datos](unsigned, std::size_t inicio, std::size_t fin) {
+        return sumar(datos + inicio, fin - inicio);
+    });
+    R total = 0;
+    for (R parcial : parciales) {
+        total += parcial;
+    }
+    return total;
+}
+
+/**
+ * @brief Mínimo repartido entre hilos.
+ * @throws std::runtime_error Si el arreglo está vacío.
+ */
+template <typename T>
+T minimoParalelo(const T* datos, std::size_t n, unsigned hilos = 0) {
+    validarNoVacio(n);
+    hilos = hilosParaReduccion(n, hilos);
+    std::vector<T> parciales = porTramos<T>(n, hilos, [datos](unsigned, std::size_t inicio, std::size_t fin) {
+        return minimo(datos + inicio, fin - inicio);
+    });
+    return minimoEscalar(parciales.data(), parciales.size());
+}
+
+/**
+ * @brief Máximo repartido entre hilos.
+ * @throws std::runtime_error Si el arreglo está vacío.
+ */
+template <typename T>
+T maximoParalelo(const T* datos, std::size_t n, unsigned hilos = 0) {
+    validarNoVacio(n);
+    hilos = hilosParaReduccion(n, hilos);
+    std::vector<T> parciales = porTramos<T>(n, hilos, [datos](unsigned, std::size_t inicio, std::size_t fin) {
+        return maximo(datos + inicio, fin - inicio);
+    });
+    return maximoEscalar(parciales.data(), parciales.size());
+}
+
+/**
+ * @brief Promedio a partir de la suma paralela.
+ * @throws std::runtime_error Si el arreglo está vacío.
+ */
+template <typename T>
+double promedioParalelo(const T* datos, std::size_t n, unsigned hilos = 0) {
+    validarNoVacio(n);
+    return static_cast<double>(sumarParalelo(datos, n, hilos)) / static_cast<double>(n);
+}
+
+/**
+ * @brief Suma prefija inclusiva repartida entre hilos.
+ * Primero cada hilo suma su tramo; con esas sumas se calcula el valor con que empieza cada tramo
+ * y después cada hilo escribe su parte de la salida. Lee el arreglo dos veces y escribe una.
+ */
+template <typename T>
+void sumaPrefijaParalela(const T* datos, std::size_t n, Acumulador<T>* salida, unsigned hilos = 0) {
+    using A = Acumulador<T>;
+    hilos = hilosParaReduccion(n, hilos);
+    if (hilos == 1) {
+        sumaPrefija(datos, n, salida);
+        return;
+    }
+    std::vector<A> sumas = porTramos<A>(n, hilos, [datos](unsigned, std::size_t inicio, std::size_t fin) {
+        return static_cast<A>(sumar(datos + inicio, fin - inicio));
+    });
+    std::vector<A> inicios(hilos, 0);
+    for (unsigned t = 1; t < hilos; ++t) {
+        inicios[t] = inicios[t - 1] + sumas[t - 1];
+    }
+    porTramos<int>(n, hilos, [datos, salida, &inicios](unsigned tramo, std::size_t inicio, std::size_t fin) {
+        sumaPrefija(datos + inicio, fin - inicio, salida + inicio, inicios[tramo]);
+        return 0;
+    });
+}
+
+#endif
@@ -0,0 +1,44 @@
+/**
+ * @file main.cpp
+ * @brief Programa de ejemplo de las reducciones.
+ * Reduce un arreglo de 10 millones de int, más de lo que aguantaba la suma recursiva,
+ * y compara el tiempo del núcleo escalar, del núcleo vectorial y de la versión paralela.
+ */
+#include "Reduccion.hpp"
+#include <chrono>
+#include <iostream>
+#include <memory>
+
+volatile long long sumidero = 0; ///< Evita que el compilador descarte las sumas medidas.
+
+/**
+ * @brief Mide en milisegundos cuánto tarda una función.
+ */
+template <typename Funcion>
+double medirMs(Funcion funcion) {
+    auto inicio = std::chrono::steady_clock::now();
+    funcion();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - inicio).count();
+}
+
+int main() {
+    const std::size_t n = 10000000;
+    std::unique_ptr<int[]> arreglo = std::make_unique<int[]>(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        arreglo[i] = static_cast<int>(i % 1000) - 500 + (i == n / 2 ? 2000000000 : 0);
+    }
+
+    std::cout << "Núcleo detectado: " << nombreNivelSimd(nivelSimdDetectado()) << "\n";
+    std::cout << "Suma: " << sumar(arreglo.get(), n) << "\n";
+    std::cout << "Mínimo: " << minimo(arreglo.get(), n) << ", máximo: " << maximo(arreglo.get(), n) << "\n";
+    std::cout << "Promedio: " << promedio(arreglo.get(), n) << "\n";
+
+    std::unique_ptr<long long[]> prefijos = std::make_unique<long long[]>(n);
+    sumaPrefijaParalela(arreglo.get(), n, prefijos.get());
+    std::cout << "Último prefijo (igual a la suma): " << prefijos[n - 1] << "\n";
+
+    std::cout << "Escalar: " << medirMs([&] { sumidero = sumarEscalar(arreglo.get(), n); }) << " ms\n";
+    std::cout << "Vectorial: " << medirMs([&] { sumidero = sumar(arreglo.get(), n); }) << " ms\n";
+    std::cout << "Paralelo: " << medirMs([&] { sumidero = sumarParalelo(arreglo.get(), n); }) << " ms\n";
+    return 0;
+}
@@ -0,0 +1,182 @@
+/**
+ * @file DequeRobo.hpp
+ * @brief Definición de la clase DequeRobo, una cola doble de robo de trabajo (Chase-Lev).
+ * El hilo dueño la usa como una Pila (push/pop por el mismo extremo) y los demás hilos
+ * la usan como una Cola (robar por el extremo opuesto), sin necesidad de candados.
+ */
+#ifndef DEQUEROBO_HPP
+#define DEQUEROBO_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @class DequeRobo
+ * @brief Cola doble de robo de trabajo de Chase y Lev.
+ *
+ * Sólo el hilo dueño puede llamar a push() y pop(), que trabajan sobre el extremo inferior en orden LIFO;
+ * así el dueño procesa primero las tareas más recientes, que suelen seguir calientes en su caché.
+ * Cualquier otro hilo puede llamar a robar(), que toma del extremo superior en orden FIFO;
+ * así los ladrones se llevan las tareas más antiguas, que suelen ser las más grandes.
+ * Los elementos se guardan en un arreglo circular que crece al doble cuando se llena.
+ * Los arreglos viejos se conservan hasta la destrucción, porque un ladrón podría estar leyendo de ellos.
+ * @tparam T Tipo de dato almacenado; debe poder copiarse trivialmente (por ejemplo, un puntero a una tarea).
+ */
+template <typename T>
+class DequeRobo {
+    static_assert(std::is_trivially_copyable<T>::value, "DequeRobo sólo admite tipos trivialmente copiables.");
+
+    private:
+        /**
+         * @brief Arreglo circular de capacidad potencia de dos.
+         */
+        struct Arreglo {
+            std::int64_t capacidad;
+            std::unique_ptr<std::atomic<T>[]> datos;
+
+            explicit Arreglo(std::int64_t cap) : capacidad(cap), datos(new std::atomic<T>[cap]) {}
+
+            T obtener(std::int64_t i) const {
+                return datos[i & (capacidad - 1)].load(std::memory_order_relaxed);
+            }
+
+            void poner(std::int64_t i, T valor) {
+                datos[i & (capacidad - 1)].store(valor, std::memory_order_relaxed);
+            }
+        };
+
+        // superior e inferior van en líneas de caché distintas: ladrones y dueño escriben en cada una
+        alignas(64) std::atomic<std::int64_t> superior; ///< Índice del próximo elemento a robar.
+        alignas(64) std::atomic<std::int64_t> inferior; ///< Índice donde el dueño hará el próximo push.
+        std::atomic<Arreglo*> arreglo;                  ///< Arreglo circular en uso.
+        std::vector<std::unique_ptr<Arreglo>> arreglos; ///< Todos los arreglos creados; sólo lo toca el dueño.
+
+        /**
+         * @brief Duplica la capacidad copiando los elementos vivos al nuevo arreglo.
+         * @param viejo Arreglo actual.
+         * @param inf Valor actual de inferior.
+         * @param sup Valor actual de superior.
+         * @return El nuevo arreglo.
+         */
+        Arreglo* crecer(Arreglo* viejo, std::int64_t inf, std::int64_t sup) {
+            auto nuevo = std::make_unique<Arreglo>(viejo->capacidad * 2);
+            for (std::int64_t i = sup; i < inf; ++i) {
+                nuevo->poner(i, viejo->obtener(i));
+            }
+            Arreglo* puntero = nuevo.get();
+            arreglos.push_back(std::move(nuevo));
+            return puntero;
+        }
+
+    public:
+        /**
+         * @brief Constructor de la clase DequeRobo.
+         * @param capacidadInicial Capacidad inicial; se redondea a la siguiente potencia de dos.
+         */
+        explicit DequeRobo(std::int64_t capacidadInicial = 64) : superior(0), inferior(0) {
+            std::int64_t capacidad = 1;
+            while (capacidad < capacidadInicial) {
+                capacidad <<= 1;
+            }
+            arreglos.push_back(std::make_unique<Arreglo>(capacidad));
+            arreglo.store(arreglos.back().get(), std::memory_order_relaxed);
+        }
+
+        DequeRobo(const DequeRobo&) = delete;
+        DequeRobo& operator=(const DequeRobo&) = delete;
+
+        /**
+         * @brief Inserta un elemento en el extremo del dueño.
+         * @param valor Valor a insertar.
+         * Sólo puede llamarlo el hilo dueño.
+         */
+        void push(T valor) {
+            std::int64_t inf = inferior.load(std::memory_order_relaxed);
+            std::int64_t sup = superior.load(std::memory_order_acquire);
+            Arreglo* a = arreglo.load(std::memory_order_relaxed);
+            if (inf - sup > a->capacidad - 1) {
+                a = crecer(a, inf, sup);
+                arreglo.store(a, std::memory_order_release);
+            }
+            a->poner(inf, valor);
+            std::atomic_thread_fence(std::memory_order_release);
+            inferior.store(inf + 1, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Extrae el elemento más reciente del extremo del dueño.
+         * @return El elemento, o std::nullopt si la deque está vacía o un ladrón se llevó el último.
+         * Sólo puede llamarlo el hilo dueño.
+         */
+        std::optional<T> pop() {
+            std::int64_t inf = inferior.load(std::memory_order_relaxed) - 1;
+            Arreglo* a = arreglo.load(std::memory_order_relaxed);
+            inferior.store(inf, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t sup = superior.load(std::memory_order_relaxed);
+
+            if (sup > inf) {
+                // Estaba vacía: se restaura inferior
+                inferior.store(inf + 1, std::memory_order_relaxed);
+                return std::nullopt;
+            }
+            T valor = a->obtener(inf);
+            if (sup == inf) {
+                // Queda un solo elemento: se compite con los ladrones por él
+                bool ganado = superior.compare_exchange_strong(sup, sup + 1, std::memory_order_seq_cst,
+                                                               std::memory_order_relaxed);
+                inferior.store(inf + 1, std::memory_order_relaxed);
+                if (!ganado) {
+                    return std::nullopt;
+                }
+            }
+            return valor;
+        }
+
+        /**
+         * @brief Roba el elemento más antiguo del extremo opuesto al dueño.
+         * @return El elemento, o std::nullopt si la deque está vacía o se perdió la carrera con otro hilo.
+         * Puede llamarlo cualquier hilo.
+         */
+        std::optional<T> robar() {
+            std::int64_t sup = superior.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t inf = inferior.load(std::memory_order_acquire);
+            if (sup >= inf) {
+                return std::nullopt;
+            }
+            Arreglo* a = arreglo.load(std::memory_order_acquire);
+            T valor = a->obtener(sup);
+            if (!superior.compare_exchange_strong(sup, sup + 1, std::memory_order_seq_cst,
+                                                  std::memory_order_relaxed)) {
+                return std::nullopt;
+            }
+            return valor;
+        }
+
+        /**
+         * @brief Verifica si la deque parece vacía.
+         * @return true si no hay elementos; con otros hilos activos el resultado es sólo aproximado.
+         */
+        bool estaVacia() const {
+            std::int64_t inf = inferior.load(std::memory_order_relaxed);
+            std::int64_t sup = superior.load(std::memory_order_relaxed);
+            return sup >= inf;
+        }
+
+        /**
+         * @brief Devuelve el número aproximado de elementos.
+         * @return Tamaño de la deque; con otros hilos activos el resultado es sólo aproximado.
+         */
+        std::int64_t tamano() const {
+            std::int64_t inf = inferior.load(std::memory_order_relaxed);
+            std::int64_t sup = superior.load(std::memory_order_relaxed);
+            return inf > sup ? inf - sup : 0;
+        }
+};
+
+#endif
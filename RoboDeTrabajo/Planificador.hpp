@@ -0,0 +1,291 @@
+/**
+ * @file Planificador.hpp
+ * @brief Definición de la clase Planificador, un grupo de hilos con robo de trabajo.
+ * Cada trabajador tiene su propia DequeRobo; las tareas enviadas desde fuera del grupo
+ * entran por una Cola compartida protegida con un candado.
+ */
+#ifndef PLANIFICADOR_HPP
+#define PLANIFICADOR_HPP
+
+#include "DequeRobo.hpp"
+#include "../Cola/Cola.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Contadores de actividad de un trabajador.
+ * Se escriben sólo desde el hilo del trabajador y se leen con estadisticas().
+ */
+struct EstadisticasTrabajador {
+    std::uint64_t ejecutadas = 0;     ///< Tareas ejecutadas por el trabajador.
+    std::uint64_t locales = 0;        ///< Tareas tomadas de su propia deque.
+    std::uint64_t compartidas = 0;    ///< Tareas tomadas de la cola compartida.
+    std::uint64_t robadas = 0;        ///< Tareas robadas a otros trabajadores.
+    std::uint64_t robosFallidos = 0;  ///< Intentos de robo que no obtuvieron tarea.
+    std::uint64_t esperas = 0;        ///< Veces que el trabajador se durmió por falta de trabajo.
+};
+
+/**
+ * @class Planificador
+ * @brief Grupo de hilos que reparte tareas mediante robo de trabajo.
+ *
+ * Una tarea enviada desde dentro de otra tarea va a la deque del trabajador actual, por lo que
+ * las tareas que se dividen recursivamente (recorridos de árboles y grafos) se reparten solas:
+ * el dueño sigue con la rama más reciente y los trabajadores ociosos roban las ramas más antiguas.
+ */
+class Planificador {
+    private:
+        using Tarea = std::function<void()>;
+
+        /**
+         * @brief Estado de cada hilo trabajador.
+         * Va alineado a una línea de caché para que los contadores de un hilo no invaliden los de otro.
+         */
+        struct alignas(64) Trabajador {
+            DequeRobo<Tarea*> deque;
+            std::atomic<std::uint64_t> ejecutadas{0};
+            std::atomic<std::uint64_t> locales{0};
+            std::atomic<std::uint64_t> compartidas{0};
+            std::atomic<std::uint64_t> robadas{0};
+            std::atomic<std::uint64_t> robosFallidos{0};
+            std::atomic<std::uint64_t> esperas{0};
+        };
+
+        std::vector<std::unique_ptr<Trabajador>> trabajadores;
+        std::vector<std::thread> hilos;
+
+        Cola<Tarea*> compartida;                  ///< Tareas enviadas desde fuera del grupo.
+        std::mutex candadoCompartida;             ///< Protege a la cola compartida.
+
+        std::atomic<std::size_t> pendientes{0};   ///< Tareas enviadas y aún no terminadas.
+        std::atomic<bool> detener{false};
+        std::mutex candadoEspera;
+        std::condition_variable hayTrabajo;       ///< Despierta a trabajadores dormidos.
+        std::condition_variable terminado;        ///< Avisa a esperar() cuando pendientes llega a 0.
+
+        std::mutex candadoError;
+        std::exception_ptr primerError;           ///< Primera excepción lanzada por una tarea.
+
+        /**
+         * @brief Índice del trabajador que ejecuta el hilo actual en este planificador, o -1 si es un hilo externo.
+         */
+        int indiceActual() const {
+            return planificadorActual() == this ? trabajadorActual() : -1;
+        }
+
+        static const Planificador*& planificadorActual() {
+            thread_local const Planificador* planificador = nullptr;
+            return planificador;
+        }
+
+        static int& trabajadorActual() {
+            thread_local int indice = -1;
+            return indice;
+        }
+
+        /**
+         * @brief Busca una tarea: primero en la deque propia, luego en la cola compartida y al final robando.
+         * @param indice Índice del trabajador que busca.
+         * @return La tarea encontrada, o nullptr si no hay trabajo disponible.
+         */
+        Tarea* buscarTarea(std::size_t indice) {
+            Trabajador& propio = *trabajadores[indice];
+            if (auto tarea = propio.deque.pop()) {
+                propio.locales.fetch_add(1, std::memory_order_relaxed);
+                return *tarea;
+            }
+            {
+                std::lock_guard<std::mutex> guardia(candadoCompartida);
+                if (!compartida.estaVacia()) {
+                    Tarea* tarea = compartida.primer();
+                    compartida.desencolar();
+                    propio.compartidas.fetch_add(1, std::memory_order_relaxed);
+                    return tarea;
+                }
+            }
+            // Se recorre a los demás trabajadores empezando por el siguiente, para no atacar siempre al mismo
+            const std::size_t n = trabajadores.size();
+            for (std::size_t k = 1; k < n; ++k) {
+                Trabajador& victima = *trabajadores[(indice + k) % n];
+                if (auto tarea = victima.deque.robar()) {
+                    propio.robadas.fetch_add(1, std::memory_order_relaxed);
+                    return *tarea;
+                }
+                propio.robosFallidos.fetch_add(1, std::memory_order_relaxed);
+            }
+            return nullptr;
+        }
+
+        /**
+         * @brief Ejecuta una tarea, guarda su excepción si la hay y descuenta las pendientes.
+         */
+        void ejecutar(Tarea* tarea, Trabajador& trabajador) {
+            std::unique_ptr<Tarea> propietario(tarea);
+            try {
+                (*propietario)();
+            } catch (...) {
+                std::lock_guard<std::mutex> guardia(candadoError);
+                if (!primerError) {
+                    primerError = std::current_exception();
+                }
+            }
+            trabajador.ejecutadas.fetch_add(1, std::memory_order_relaxed);
+            if (pendientes.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                std::lock_guard<std::mutex> guardia(candadoEspera);
+                terminado.notify_all();
+            }
+        }
+
+        /**
+         * @brief Bloquea hasta que el número de tareas pendientes llegue a 0.
+         */
+        void esperarTareas() {
+            std::unique_lock<std::mutex> candado(candadoEspera);
+            terminado.wait(candado, [this] { return pendientes.load(std::memory_order_acquire) == 0; });
+        }
+
+        /**
+         * @brief Bucle principal de cada hilo trabajador.
+         * Si no encuentra trabajo cede el procesador unas veces antes de dormirse brevemente.
+         */
+        void bucle(std::size_t indice) {
+            planificadorActual() = this;
+            trabajadorActual() = static_cast<int>(indice);
+            Trabajador& propio = *trabajadores[indice];
+            int intentosVacios = 0;
+            while (!detener.load(std::memory_order_acquire)) {
+                Tarea* tarea = buscarTarea(indice);
+                if (tarea) {
+                    intentosVacios = 0;
+                    ejecutar(tarea, propio);
+                    continue;
+                }
+                if (++intentosVacios < 64) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                propio.esperas.fetch_add(1, std::memory_order_relaxed);
+                // La espera tiene un límite de tiempo, así un aviso perdido sólo cuesta un milisegundo
+                std::unique_lock<std::mutex> candado(candadoEspera);
+                if (!detener.load(std::memory_order_acquire)) {
+                    hayTrabajo.wait_for(candado, std::chrono::milliseconds(1));
+                }
+                intentosVacios = 0;
+            }
+            planificadorActual() = nullptr;
+            trabajadorActual() = -1;
+        }
+
+    public:
+        /**
+         * @brief Constructor que arranca los hilos trabajadores.
+         * @param numeroHilos Número de trabajadores; 0 usa el número de núcleos disponibles.
+         */
+        explicit Planificador(std::size_t numeroHilos = 0) {
+            if (numeroHilos == 0) {
+                numeroHilos = std::thread::hardware_concurrency();
+                if (numeroHilos == 0) numeroHilos = 1;
+            }
+            for (std::size_t i = 0; i < numeroHilos; ++i) {
+                trabajadores.push_back(std::make_unique<Trabajador>());
+            }
+            for (std::size_t i = 0; i < numeroHilos; ++i) {
+                hilos.emplace_back([this, i] { bucle(i); });
+            }
+        }
+
+        /**
+         * @brief Destructor que espera las tareas pendientes y detiene los hilos.
+         */
+        ~Planificador() {
+            esperarTareas();
+            detener.store(true, std::memory_order_release);
+            {
+                std::lock_guard<std::mutex> guardia(candadoEspera);
+                hayTrabajo.notify_all();
+            }
+            for (std::thread& hilo : hilos) {
+                hilo.join();
+            }
+        }
+
+        Planificador(const Planificador&) = delete;
+        Planificador& operator=(const Planificador&) = delete;
+
+        /**
+         * @brief Envía una tarea para su ejecución.
+         * @param tarea Función sin argumentos a ejecutar.
+         * Desde un trabajador, la tarea va a su propia deque; desde fuera, a la cola compartida.
+         */
+        void enviar(Tarea tarea) {
+            Tarea* nueva = new Tarea(std::move(tarea));
+            pendientes.fetch_add(1, std::memory_order_acq_rel);
+            int indice = indiceActual();
+            if (indice >= 0) {
+                trabajadores[indice]->deque.push(nueva);
+            } else {
+                std::lock_guard<std::mutex> guardia(candadoCompartida);
+                compartida.encolar(nueva);
+            }
+            hayTrabajo.notify_one();
+        }
+
+        /**
+         * @brief Bloquea hasta que todas las tareas enviadas hayan terminado.
+         * @throws std::logic_error Si se llama desde una tarea del propio planificador, donde nunca terminaría.
+         * @throws Relanza la primera excepción lanzada por alguna tarea.
+         * Las tareas que se dividen no necesitan esperar a sus hijas: basta con que el hilo externo llame a esperar().
+         */
+        void esperar() {
+            if (indiceActual() >= 0) {
+                throw std::logic_error("esperar() no puede llamarse desde una tarea del planificador.");
+            }
+            esperarTareas();
+            std::exception_ptr error;
+            {
+                std::lock_guard<std::mutex> guardia(candadoError);
+                std::swap(error, primerError);
+            }
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+
+        /**
+         * @brief Devuelve el número de hilos trabajadores.
+         */
+        std::size_t numeroHilos() const {
+            return trabajadores.size();
+        }
+
+        /**
+         * @brief Devuelve una copia de los contadores de cada trabajador.
+         * @return Un elemento por trabajador, en orden.
+         */
+        std::vector<EstadisticasTrabajador> estadisticas() const {
+            std::vector<EstadisticasTrabajador> resultado;
+            for (const auto& t : trabajadores) {
+                EstadisticasTrabajador e;
+                e.ejecutadas = t->ejecutadas.load(std::memory_order_relaxed);
+                e.locales = t->locales.load(std::memory_order_relaxed);
+                e.compartidas = t->compartidas.load(std::memory_order_relaxed);
+                e.robadas = t->robadas.load(std::memory_order_relaxed);
+                e.robosFallidos = t->robosFallidos.load(std::memory_order_relaxed);
+                e.esperas = t->esperas.load(std::memory_order_relaxed);
+                resultado.push_back(e);
+            }
+            return resultado;
+        }
+};
+
+#endif
@@ -0,0 +1,63 @@
+/**
+ * @file main.cpp
+ * @brief Programa principal que utiliza DequeRobo y Planificador.
+ * Muestra el orden LIFO del dueño y FIFO de los ladrones, y suma un rango en paralelo
+ * dividiéndolo recursivamente en tareas que se reparten por robo de trabajo.
+ */
+#include "Planificador.hpp"
+#include <atomic>
+#include <iostream>
+
+/**
+ * @brief Suma el rango [inicio, fin) dividiéndolo en tareas hasta llegar al tamaño de grano.
+ * @param planificador Planificador donde se envían las mitades.
+ * @param inicio Primer valor del rango.
+ * @param fin Valor siguiente al último del rango.
+ * @param total Acumulador compartido.
+ */
+void sumaParalela(Planificador& planificador, long long inicio, long long fin, std::atomic<long long>& total) {
+    const long long grano = 10000;
+    while (fin - inicio > grano) {
+        // Se envía la mitad derecha y se sigue dividiendo la izquierda en este mismo hilo
+        long long mitad = inicio + (fin - inicio) / 2;
+        planificador.enviar([&planificador, mitad, fin, &total] {
+            sumaParalela(planificador, mitad, fin, total);
+        });
+        fin = mitad;
+    }
+    long long parcial = 0;
+    for (long long i = inicio; i < fin; ++i) {
+        parcial += i;
+    }
+    total.fetch_add(parcial, std::memory_order_relaxed);
+}
+
+int main() {
+    // El dueño saca el más reciente y el ladrón el más antiguo
+    DequeRobo<int> deque;
+    deque.push(1);
+    deque.push(2);
+    deque.push(3);
+    std::cout << "pop del dueño: " << *deque.pop() << "\n";     // 3
+    std::cout << "robo de otro hilo: " << *deque.robar() << "\n"; // 1
+
+    Planificador planificador;
+    std::atomic<long long> total{0};
+    const long long n = 100000000;
+    planificador.enviar([&planificador, &total, n] {
+        sumaParalela(planificador, 0, n, total);
+    });
+    planificador.esperar();
+    std::cout << "Suma de 0 a " << n - 1 << ": " << total.load() << " (esperado " << n * (n - 1) / 2 << ")\n";
+
+    std::cout << "Estadísticas por trabajador:\n";
+    std::vector<EstadisticasTrabajador> estadisticas = planificador.estadisticas();
+    for (std::size_t i = 0; i < estadisticas.size(); ++i) {
+        const EstadisticasTrabajador& e = estadisticas[i];
+        std::cout << "  Trabajador " << i << ": ejecutadas=" << e.ejecutadas << " locales=" << e.locales
+                  << " compartidas=" << e.compartidas << " robadas=" << e.robadas
+                  << " robosFallidos=" << e.robosFallidos << " esperas=" << e.esperas << "\n";
+    }
+
+    return 0;
+}
@@ -1,28 +1,55 @@
 #include <iostream>
 #include <memory> // Para std::unique_ptr y std::make_unique
+#include <string>
+#include <cstdint>
+#include "Entrada/Entrada.hpp"
+#include "ArregloDinamico/ArregloDinamico.hpp"
+
+// Muestra el contenido de cualquier arreglo contiguo a través de una vista, sin copiarlo
+void mostrar(const Tramo<int32_t>& arreglo) {
+    std::string salida;
+    for (std::size_t i = 0; i < arreglo.tamano(); ++i) {
+        salida += "arreglo[" + std::to_string(i) + "] = " + std::to_string(arreglo[i]) + "\n";
+    }
+    std::cout << salida;
+}
+
+int main(int argc, char* argv[]) {
+    // Con un archivo (o "-" para la entrada estándar) no se piden los valores uno por uno: programa archivo [--texto|--int32]
+    if (argc > 1) {
+        try {
+            std::string ruta = argv[1];
+            FormatoEntrada formato = argc > 2 ? formatoDesdeOpcion(argv[2]) : FormatoEntrada::Texto;
+            DatosEnteros<int32_t> datos = ruta == "-" ? leerEnterosDeFlujo<int32_t>(stdin) : DatosEnteros<int32_t>(ruta, formato);
+            std::cout << "Contenido del arreglo (" << datos.tamano() << " elementos):\n";
+            mostrar(datos.tramo());
+        } catch (const std::exception& e) {
+            std::cerr << e.what() << "\n";
+            return 1;
+        }
+        return 0;
+    }
 
-int main() {
     int tamaño;
 
     std::cout << "Ingrese el tamaño del arreglo: ";
     std::cin >> tamaño;
 
-    // Crear arreglo dinámico de enteros con unique_ptr
-    std::unique_ptr<int[]> arreglo = std::make_unique<int[]>(tamaño);
+    // Crear arreglo dinámico de enteros; igual que unique_ptr<int[]> es dueño de su memoria,
+    // pero además verifica los límites con en() y puede crecer con agregar()
+    ArregloDinamico<int32_t> arreglo(tamaño > 0 ? tamaño : 0);
 
     // Llenar el arreglo con datos
     std::cout << "Ingrese " << tamaño << " valores enteros:\n";
     for (int i = 0; i < tamaño; ++i) {
         std::cout << "Elemento [" << i << "]: ";
-        std::cin >> arreglo[i];
+        std::cin >> arreglo.en(i);
     }
 
     // Mostrar los datos ingresados
     std::cout << "\nContenido del arreglo:\n";
-    for (int i = 0; i < tamaño; ++i) {
-        std::cout << "arreglo[" << i << "] = " << arreglo[i] << "\n";
-    }
+    mostrar(Tramo<int32_t>(arreglo.datos(), arreglo.obtenerTamano()));
 
-    // No necesitas liberar nada: unique_ptr lo hace automáticamente
+    // No necesitas liberar nada: el arreglo lo hace automáticamente
     return 0;
 }
\ No newline at end of file
@@ -1,7 +1,37 @@
 #include <iostream>
+#include <string>
+#include <cstdint>
+#include "Entrada/Entrada.hpp"
+#include "ArregloDinamico/ArregloDinamico.hpp"
 using namespace std;
 
-int main() {
+// Imprime los valores sin copiarlos: el Tramo apunta al archivo mapeado o a los números ya analizados
+void imprimir(const Tramo<int32_t>& valores) {
+    string salida;
+    salida.reserve(valores.tamano() * 8);
+    for (int32_t valor : valores) {
+        salida += to_string(valor);
+        salida += ' ';
+    }
+    cout << salida << endl;
+}
+
+int main(int argc, char* argv[]) {
+    // Con un archivo (o "-" para la entrada estándar) los datos se cargan de una vez: programa archivo [--texto|--int32]
+    if (argc > 1) {
+        try {
+            string ruta = argv[1];
+            FormatoEntrada formato = argc > 2 ? formatoDesdeOpcion(argv[2]) : FormatoEntrada::Texto;
+            DatosEnteros<int32_t> datos = ruta == "-" ? leerEnterosDeFlujo<int32_t>(stdin) : DatosEnteros<int32_t>(ruta, formato);
+            cout << "Los valores leídos son:" << endl;
+            imprimir(datos.tramo());
+        } catch (const exception& e) {
+            cerr << e.what() << endl;
+            return 1;
+        }
+        return 0;
+    }
+
     int n;
 
     // Paso 1: Pedir al usuario cuántos elementos desea
@@ -9,24 +39,23 @@ int main() {
     cin >> n;
 
     // Paso 2: Crear arreglo dinámico
-    int* arreglo = new int[n]; //Un arreglo normal debe conocerse antes de la ejecución para funcionar correctamente, este permite hacerlo en la ejecución
+    ArregloDinamico<int32_t> arreglo; //Un arreglo normal debe conocerse antes de la ejecución para funcionar correctamente, este permite hacerlo en la ejecución y además puede crecer
+    arreglo.reservar(n > 0 ? n : 0);
 
     // Paso 3: Llenar el arreglo
     cout << "Ingresa " << n << " números:" << endl;
     for (int i = 0; i < n; i++) {
+        int32_t valor;
         cout << "Elemento " << i + 1 << ": ";
-        cin >> arreglo[i];
+        cin >> valor;
+        arreglo.agregar(valor);
     }
 
     // Paso 4: Imprimir los valores
     cout << "Los valores ingresados son:" << endl;
-    for (int i = 0; i < n; i++) {
-        cout << arreglo[i] << " ";
-    }
-    cout << endl;
+    imprimir(Tramo<int32_t>(arreglo.datos(), arreglo.obtenerTamano()));
 
-    // Paso 5: Liberar la memoria
-    delete[] arreglo; //Siempre al terminar de usarlo para evitar fugas de memoria
+    // Paso 5: La memoria se libera sola cuando el arreglo sale de alcance, no hace falta delete[]
 
     return 0;
 }
@@ -0,0 +1,43 @@
+# Compilación guiada por perfil en tres pasos, sobre un mismo directorio de compilación:
+#   1. Configura con ESTRUCTURAS_PGO=GENERAR y compila los ejecutables instrumentados.
+#   2. Corre la carga de entrenamiento (target entrenar-pgo), que escribe los perfiles.
+#   3. Reconfigura con ESTRUCTURAS_PGO=USAR y recompila todo con los perfiles.
+# GCC guarda los perfiles con el nombre de cada archivo objeto, por eso los tres pasos usan el mismo directorio.
+#
+# Uso: cmake [-DDIR=_build/pgo] [-DGENERADOR=Ninja] [-DOPCIONES="-DESTRUCTURAS_LTO=ON"] -P cmake/PGO.cmake
+
+get_filename_component(FUENTES "${CMAKE_CURRENT_LIST_DIR}/.." ABSOLUTE)
+if(NOT DIR)
+    set(DIR "${FUENTES}/_build/pgo")
+endif()
+get_filename_component(DIR "${DIR}" ABSOLUTE)
+set(PERFILES "${DIR}/perfiles-pgo")
+
+set(generador)
+if(GENERADOR)
+    set(generador -G "${GENERADOR}")
+endif()
+separate_arguments(opciones UNIX_COMMAND "${OPCIONES}")
+
+function(ejecutar descripcion)
+    message(STATUS "PGO: ${descripcion}")
+    execute_process(COMMAND ${ARGN} RESULT_VARIABLE resultado)
+    if(NOT resultado EQUAL 0)
+        message(FATAL_ERROR "PGO: falló el paso \"${descripcion}\" (código ${resultado}).")
+    endif()
+endfunction()
+
+# Los perfiles de una corrida anterior no corresponderían al código actual
+file(REMOVE_RECURSE "${PERFILES}")
+
+ejecutar("configurar la compilación instrumentada"
+    "${CMAKE_COMMAND}" -S "${FUENTES}" -B "${DIR}" ${generador} -DCMAKE_BUILD_TYPE=Release
+    -DESTRUCTURAS_PGO=GENERAR "-DESTRUCTURAS_PGO_DIR=${PERFILES}" ${opciones})
+ejecutar("compilar y correr el entrenamiento"
+    "${CMAKE_COMMAND}" --build "${DIR}" --target entrenar-pgo --parallel)
+ejecutar("configurar la compilación con perfiles"
+    "${CMAKE_COMMAND}" -S "${FUENTES}" -B "${DIR}" -DESTRUCTURAS_PGO=USAR)
+ejecutar("compilar con perfiles"
+    "${CMAKE_COMMAND}" --build "${DIR}" --parallel)
+
+message(STATUS "PGO: listo, los ejecutables optimizados están en ${DIR}")
@@ -1,13 +1,10 @@
 #include <iostream>
-unsigned long long factorial (unsigned int n){
-    if (n==0)
-    {
-        return 1; // Caso base
-    }
-    else{
-        return n * factorial(n - 1); // Caso recursivo
-    }
-    
+#include "Factorial/Factorial.hpp"
+
+// unsigned long long se desbordaba en silencio a partir de 21! y la recursión hacía una llamada por número.
+// factorialExacto() da el resultado completo multiplicando los factores en un árbol de productos.
+EnteroGrande factorial (unsigned int n){
+    return factorialExacto(n);
 }
 int main() {
     unsigned int numero;
@@ -18,4 +15,4 @@ int main() {
     std::cout << "El factorial de " << numero << " es: " << factorial(numero) << "\n";
 
     return 0;
-}
\ No newline at end of file
+}
@@ -15,7 +15,7 @@ int main(){
     std::cout<<"*p: "<<*p<<"\n"; //Imprime el nuevo valor de x mediante el puntero
     /* nullptr sirve para inicializar punteros seguros que no usaremos aun, de esta forma evitamos errores de acceso a memoria aleatoria */
     int* ptr{nullptr}; //Este puntero no apunta a nada
-    if (p==nullptr)
+    if (ptr==nullptr)
     {
         std::cout<<"El puntero ptr no apunta a nada"<<"\n";
     }
@@ -25,7 +25,7 @@ int main(){
     
     //Esto crea un int dinámico, que se almacena en el heap, el heap es una región de memoria que se utiliza para almacenar datos dinámicos, como objetos y arreglos, que pueden crecer o decrecer en tamaño durante la ejecución del programa.
     //ptr es un puntero que apunta a la dirección de memoria donde se almacena el entero dinámico.
-    int* ptr = new int(99); // crea una variable dinámica
+    ptr = new int(99); // crea una variable dinámica
     std::cout << "Valor de ptr: " << *ptr << "\n"; // Imprime 99
     delete ptr; // libera la memoria dinámica
     return 0;
@@ -1,18 +1,44 @@
 #include <iostream>
 #include <memory>
-int long long suma(const std::unique_ptr<int[]>& arreglo, int indice, int n){
-    if (indice==n)
-    {
+#include <string>
+#include <cstdint>
+#include "Reduccion/Reduccion.hpp"
+#include "Entrada/Entrada.hpp"
+
+// La suma ya no es recursiva: con una llamada por elemento, un arreglo de millones de elementos
+// desbordaba la pila. sumar() recorre el arreglo con un ciclo vectorizado y acumula en 64 bits.
+int long long suma(const std::unique_ptr<int[]>& arreglo, int n){
+    return sumar(arreglo.get(), static_cast<std::size_t>(n));
+}
+
+// Suma directamente sobre la vista del archivo, sin copiar los datos a un arreglo propio
+template <typename T>
+long long suma(const Tramo<T>& valores){
+    return static_cast<long long>(sumarParalelo(valores.datos(), valores.tamano()));
+}
+
+int main(int argc, char* argv[]){
+    // Con un archivo (o "-" para la entrada estándar): programa archivo [--texto|--int32|--int64]
+    if (argc > 1) {
+        try {
+            std::string ruta = argv[1];
+            FormatoEntrada formato = argc > 2 ? formatoDesdeOpcion(argv[2]) : FormatoEntrada::Texto;
+            long long total;
+            if (formato == FormatoEntrada::BinarioInt64) {
+                DatosEnteros<int64_t> datos(ruta, formato);
+                total = suma(datos.tramo());
+            } else {
+                DatosEnteros<int32_t> datos = ruta == "-" ? leerEnterosDeFlujo<int32_t>(stdin) : DatosEnteros<int32_t>(ruta, formato);
+                total = suma(datos.tramo());
+            }
+            std::cout<<"La sumatoria es: "<<total<<"\n";
+        } catch (const std::exception& e) {
+            std::cerr<<e.what()<<"\n";
+            return 1;
+        }
         return 0;
     }
-    else
-    {
-        return arreglo[indice] + suma(arreglo, indice + 1, n);
-    }
-    
-}
 
-int main(){
     int tamanio{0};
     std::cout<<"Ingrese el tamaño del arreglo: \n";
     std::cin>>tamanio;
@@ -22,5 +48,5 @@ int main(){
         std::cout << "Elemento [" << i << "]: ";
         std::cin >> arreglo[i];
     }
-    std::cout<<"La sumatoria es: "<<suma(arreglo, 0, tamanio);
-}
\ No newline at end of file
+    std::cout<<"La sumatoria es: "<<suma(arreglo, tamanio);
+}